@@ -8,7 +8,7 @@ static const Command m_command[] PROGMEM = {
 	{B, 3},
 	{NOTHING, 14},
 
-	//----------Battle Tower [3,35]----------
+	//----------Battle Tower [3,37]----------
 	//AA (17s) AA^AA^AAA (17s) AABB (0.8s) ^
 	{A, 25},
 	{NOTHING, 75},
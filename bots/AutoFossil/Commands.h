@@ -1,5 +1,9 @@
 #include "../Joystick.h"
 #include <avr/pgmspace.h>
+#include "SoftReset.h"
+
+// Where SOFTRESET_COMMANDS is in m_command
+#define SOFTRESET 16
 
 static const Command m_command[] PROGMEM = {
 	//----------Setup [0,2]----------
@@ -20,39 +24,15 @@ static const Command m_command[] PROGMEM = {
 	{A, 32},		// 1st fossil
 	{NOTHING, 1},
 
-	//----------Get fossil [11,28]----------
+	//----------Get fossil [11,13]----------
 	{A, 20},		// Yes please
 	{NOTHING, 1},
-	{A, 160},		// OK. Restoration time...
-	{NOTHING, 1},
-	{A, 30},		// All right, I'll stick 'em together! ...
-	{NOTHING, 1},
-	{A, 20},		// Objective complete...
-	{NOTHING, 1},
-	{A, 16},		// Yes, I can see it in its eyes...
-	{NOTHING, 1},
-	{A, 180},		// Please take and care for this Pokemon, huh. (Music plays)
-	{NOTHING, 1},
-	{B, 80},		// You received XXX! (please check if this is a shiny here)
-	{NOTHING, 1},
-	{B, 24},		// Send to box
-	{NOTHING, 1},
-	{B, 60},		// XXX has been sent to box
-	{NOTHING, 1},
+	{B_SPAM, 593},		// Restoration, the music, You received XXX! (please check if this is a shiny here), sent to box
 
-	//----------Finish/Prepare SR [29,30]----------
+	//----------Finish/Prepare SR [14,15]----------
 	{HOME, 1},		// (We use this to tell player it is done, if m_autoSoftReset = false
 	{NOTHING, 40},
 
-	//----------Soft reset [31,40]----------
-	{X, 1},			// Close game
-	{NOTHING, 8},
-	{A, 1},			// Comfirm close game
-	{NOTHING, 120},
-	{A, 1},			// Choose game
-	{NOTHING, 50},
-	{A, 1},			// Pick User
-	{NOTHING, 800},
-	{A, 1},			// Enter game
-	{NOTHING, 460}
+	//----------Soft reset [16,23]----------
+	SOFTRESET_COMMANDS
 };
@@ -1,4 +1,4 @@
-bool m_firstFossilTopSlot = true; 	// true (top), false (bottom)
-bool m_secondFossilTopSlot = false; 	// true (top), false (bottom)
-int m_timesBeforeSR = 150; 			// Number of fossils to get before restarting/stopping
-bool m_autoSoftReset = false;		// true: Auto soft-reset after complete, false: stop when done
+static const bool m_firstFossilTopSlot = true; 	// true (top), false (bottom)
+static const bool m_secondFossilTopSlot = false; 	// true (top), false (bottom)
+static const int m_timesBeforeSR = 150; 			// Number of fossils to get before restarting/stopping
+static const bool m_autoSoftReset = false;		// true: Auto soft-reset after complete, false: stop when done
@@ -18,135 +18,98 @@ exception of Home and Capture. Descriptor modification allows us to unlock
 these buttons for our use.
 */
 
-#include <stdlib.h>
 #include "../Joystick.h"
 #include "Commands.h"
 #include "Config.h"
 
-// Main entry point.
-int main(void) {
-	srand(m_seed);
-	// We'll start by performing hardware and peripheral setup.
-	SetupHardware();
-	// We'll then enable global interrupts for our use.
-	GlobalInterruptEnable();
-	// Once that's done, we'll enter an infinite loop.
-	for (;;)
-	{
-		// We need to run our task to process and deliver data for our IN and OUT endpoints.
-		HID_Task();
-		// We also need to run the main USB management task.
-		USB_USBTask();
-	}
-}
+#define ECHOES 2
+uint8_t echoes = 0;
+USB_JoystickReport_Input_t last_report;
 
-// Configures hardware and peripherals, such as the USB peripherals.
-void SetupHardware(void) {
-	// We need to disable watchdog if enabled by bootloader/fuses.
-	MCUSR &= ~(1 << WDRF);
-	wdt_disable();
-
-	// We need to disable clock division before initializing the USB hardware.
-	//clock_prescale_set(clock_div_1);
-	// We can then initialize our hardware and peripherals, including the USB stack.
-
-	#ifdef ALERT_WHEN_DONE
-	// Both PORTD and PORTB will be used for the optional LED flashing and buzzer.
-	#warning LED and Buzzer functionality enabled. All pins on both PORTB and \
-PORTD will toggle when printing is done.
-	DDRD  = 0xFF; //Teensy uses PORTD
-	PORTD =  0x0;
-                  //We'll just flash all pins on both ports since the UNO R3
-	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
-	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
-	#endif
-	// The USB stack should be initialized last.
-	USB_Init();
-}
+Command tempCommand;
+int durationCount = 0;
 
-// Fired to indicate that the device is enumerating.
-void EVENT_USB_Device_Connect(void) {
-	// We can indicate that we're enumerating here (via status LEDs, sound, etc.).
+// start and end index of "Setup"
+int commandIndex = 0;
+int m_endIndex = 2;
+int m_sequence = -1;
+uint16_t m_linkCodeIndex = 0;
+bool m_linkCodeFlipped = false; // Toggled each raid when m_alternate is set
+uint8_t currentNumber = 0;
+uint8_t m_linkCodeDigit = 0; // Digit of the link code being entered
+uint8_t m_cursor = 0; // Key of the keypad the cursor is on
+
+// Digit 0 to 7 of the selected link code. The codes are packed BCD, first
+// digit in the top nibble, so on the little-endian AVR digits 0 and 1 are in
+// the last byte.
+static uint8_t GetLinkCodeDigit(uint8_t digit) {
+	uint8_t packed = pgm_read_byte((const uint8_t*)&m_linkCodes[m_linkCodeIndex] + 3 - digit / 2);
+	return (digit & 1) ? (packed & 0x0F) : (packed >> 4);
 }
 
-// Fired to indicate that the device is no longer connected to a host.
-void EVENT_USB_Device_Disconnect(void) {
-	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
+// The digit of the link code to enter next.
+static uint8_t NextLinkCodeDigit(void) {
+	return m_useRandomCode ? Random_Range(10) : GetLinkCodeDigit(m_linkCodeDigit);
 }
 
-// Fired when the host set the current configuration of the USB device after enumeration.
-void EVENT_USB_Device_ConfigurationChanged(void) {
-	bool ConfigSuccess = true;
-
-	// We setup the HID report endpoints.
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-
-	// We can read ConfigSuccess to indicate a success or failure at this point.
+// The keypad is 1 to 9 in rows of three, with 0 under 8.
+static uint8_t KeyRow(uint8_t key) {
+	return key ? (key - 1) / 3 : 3;
 }
 
-// Process control requests sent to the device from the USB host.
-void EVENT_USB_Device_ControlRequest(void) {
-	// We can handle two control requests: a GetReport and a SetReport.
-
-	// Not used here, it looks like we don't receive control request from the Switch.
+static uint8_t KeyColumn(uint8_t key) {
+	return key ? (key - 1) % 3 : 1;
 }
 
-// Process and deliver data from IN and OUT endpoints.
-void HID_Task(void) {
-	// If the device isn't connected and properly configured, we can't do anything here.
-	if (USB_DeviceState != DEVICE_STATE_Configured)
-		return;
+// Picks the next input of the link code: a single cursor move towards
+// currentNumber, or A once the cursor is on it. DOWN from any key of the
+// bottom row (7, 8 or 9) lands on 0, and UP from 0 lands on 8, so we move
+// vertically first and never need to line up with 0's column.
+static int GetLinkCodeInput(void) {
+	uint8_t row = KeyRow(m_cursor);
+	uint8_t column = KeyColumn(m_cursor);
+	uint8_t targetRow = KeyRow(currentNumber);
+	uint8_t targetColumn = KeyColumn(currentNumber);
+	int input;
+
+	if (row == targetRow && (row == 3 || column == targetColumn))
+	{
+		m_linkCodeDigit++;
+		return 35;	// A
+	}
 
-	// We'll start with the OUT endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
-	// We'll check to see if we received something on the OUT endpoint.
-	if (Endpoint_IsOUTReceived())
+	if (row != targetRow)
 	{
-		// If we did, and the packet has data, we'll react to it.
-		if (Endpoint_IsReadWriteAllowed())
+		if (row > targetRow)
 		{
-			// We'll create a place to store our data received from the host.
-			USB_JoystickReport_Output_t JoystickOutputData;
-			// We'll then take in that data, setting it up in our storage.
-			while(Endpoint_Read_Stream_LE(&JoystickOutputData, sizeof(JoystickOutputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-			// At this point, we can react to this data.
-
-			// However, since we're not doing anything with this data, we abandon it.
+			row--;
+			input = 37;	// UP
+		}
+		else
+		{
+			row++;
+			input = 29;	// DOWN
 		}
-		// Regardless of whether we reacted to the data, we acknowledge an OUT packet on this endpoint.
-		Endpoint_ClearOUT();
 	}
-
-	// We'll then move on to the IN endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
-	// We first check to see if the host is ready to accept data.
-	if (Endpoint_IsINReady())
+	else if (column > targetColumn)
 	{
-		// We'll create an empty report.
-		USB_JoystickReport_Input_t JoystickInputData;
-		// We'll then populate this report with what we want to send to the host.
-		GetNextReport(&JoystickInputData);
-		// Once populated, we can output this data to the host. We do this by first writing the data to the control stream.
-		while(Endpoint_Write_Stream_LE(&JoystickInputData, sizeof(JoystickInputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-		// We then send an IN packet on this endpoint.
-		Endpoint_ClearIN();
+		column--;
+		input = 43;	// LEFT
+	}
+	else
+	{
+		column++;
+		input = 51;	// RIGHT
 	}
-}
-
-#define ECHOES 2
-uint8_t echoes = 0;
-USB_JoystickReport_Input_t last_report;
 
-Command tempCommand;
-int durationCount = 0;
+	m_cursor = (row == 3) ? 0 : row * 3 + column + 1;
+	return input;
+}
 
-// start and end index of "Setup"
-int commandIndex = 0;
-int m_endIndex = 2;
-int m_sequence = -1;
-int m_linkCodeIndex = 0;
-uint8_t currentNumber = 0;
+// Seed the random link codes.
+void SetupBot(void) {
+	Random_Init(m_seed);
+}
 
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
@@ -178,7 +141,7 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 		if (m_sequence == 0)	// Raid hosting
 		{
       // Randomize set link code index
-      m_linkCodeIndex = rand() % (sizeof(m_linkCodes) / sizeof(m_linkCodes[0]));
+      m_linkCodeIndex = Random_Range(sizeof(m_linkCodes) / sizeof(m_linkCodes[0]));
 
 			if (m_skip3Days)
 			{
@@ -205,64 +168,45 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 		// ------------------------------------------------
 		else if (m_sequence == 2)
 		{
-			if (!m_useLinkCode)
+			bool useLinkCode = (m_useLinkCode != m_linkCodeFlipped);
+			if (m_alternate) {
+				m_linkCodeFlipped = !m_linkCodeFlipped;
+			}
+
+			if (!useLinkCode)
 			{
-				if (m_alternate) {
-					m_useLinkCode = true;
-				}
 				// Skip to start raid
 				m_sequence = 26;
 				return;
 			}
 			else
 			{
-				if (m_alternate) {
-					m_useLinkCode = false;
-				}
-
 				// Prepare link code, goto 0
 				commandIndex = 27;
 				m_endIndex = 34;
+				m_linkCodeDigit = 0;
+				m_cursor = 0;
+				currentNumber = NextLinkCodeDigit();
 			}
 		}
-		else if (m_sequence >= 3 && m_sequence <= 25)
+		else if (m_sequence == 3)
 		{
-			// Entering link code
-			if (m_sequence % 3 == 0) // 3,6,9,12,15,18,21,24
-			{
-				currentNumber = m_useRandomCode ? (rand() % 10) : m_linkCodes[m_linkCodeIndex][m_sequence / 3 - 1];
-
-				if (currentNumber == 0)
-				{
-					// Just press A for 0
-					commandIndex = 35;
-					m_endIndex = 36;
+			// Entering link code, one cursor move or A press at a time
+			commandIndex = GetLinkCodeInput();
+			m_endIndex = commandIndex + 1;
 
-					// Skip going down (24 is last input, only skip 1)
-					m_sequence += (m_sequence == 24) ? 1 : 2;
-				}
-				else if (currentNumber % 3 == 0) // 3,6,9
-				{
-					commandIndex = 45 + (currentNumber / 3 - 1) * 2;
-					m_endIndex = 52;
-				}
-				else // 1,4,7,2,5,8
+			if (m_linkCodeDigit < 8)
+			{
+				// The digit was entered, move on to the next one
+				if (commandIndex == 35)
 				{
-					commandIndex = 37 + (currentNumber / 3) * 2;
-					m_endIndex = (currentNumber % 3 == 1) ? 44 : 42;
+					currentNumber = NextLinkCodeDigit();
 				}
+				m_sequence = 2;
 			}
-			else if (m_sequence % 3 == 1) // 4,7,10,13
+			else
 			{
-				// Press A
-				commandIndex = 35;
-				m_endIndex = 36;
-			}
-			else // 5,8,11,14,17,20,23
-			{
-				// Reset to 0 (optimized number of down presses)
-				commandIndex = 29 + ((currentNumber - 1) / 3) * 2 ;
-				m_endIndex = 34;
+				m_sequence = 25;
 			}
 		}
 		else if (m_sequence == 26)
@@ -275,8 +219,8 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 		{
 			if (m_addFriends)
 			{
-				commandIndex = 161;
-				m_endIndex = (m_waitTime == 0) ? 163 : 164;
+				commandIndex = 159;
+				m_endIndex = (m_waitTime == 0) ? 161 : 162;
 
 				// Jump to add friend sequence
 				m_sequence = 200;
@@ -307,16 +251,17 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 			{
 				// Soft reset
 				commandIndex = 57;
-				m_endIndex = 68;
+				m_endIndex = SOFTRESET + SOFTRESET_END;
 			}
 			else
 			{
 				// Unsafe DC
-				commandIndex = 69;
-				m_endIndex = 92;
+				commandIndex = 67;
+				m_endIndex = 90;
 			}
 
 			m_sequence = -1;
+			Telemetry_Loop();
 		}
 		// ------------------------------------------------
 		// Day skipping
@@ -324,14 +269,14 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 		else if (m_sequence == 101)
 		{
 			// Sync and unsync time
-			commandIndex = 93;
-			m_endIndex = 130;
+			commandIndex = DATETIME + DATETIME_SETTINGS;
+			m_endIndex = DATETIME + DATETIME_SYNC_END;
 		}
 		else if (m_sequence == 102)
 		{
 			// Back to game after resetting time
-			commandIndex = 143;
-			m_endIndex = 146;
+			commandIndex = DATETIME + DATETIME_BACK;
+			m_endIndex = DATETIME + DATETIME_BACK_END;
 		}
 		else if (m_sequence == 118)
 		{
@@ -347,45 +292,37 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 			{
         if (m_sequence == 103) {
 					// First time, just invite others
-					commandIndex = 155;
+					commandIndex = 153;
         }
         else {
           // Collect watts and invite others
-          commandIndex = 151;
+          commandIndex = 149;
         }
-				m_endIndex = 160;
+				m_endIndex = 158;
 			}
 			else if (m_sequence % 5 == 4)	// 104,109,114
 			{
 				// Goto date and time 1
-				commandIndex = 93;
-				m_endIndex = 126;
+				commandIndex = DATETIME + DATETIME_SETTINGS;
+				m_endIndex = DATETIME + DATETIME_SETTINGS_END;
 			}
 			else if (m_sequence % 5 == 0)	// 105,110,115
 			{
 				// Goto date and time 2
-				commandIndex = 131;
-				m_endIndex = 134;
+				commandIndex = DATETIME + DATETIME_PICKER;
+				m_endIndex = DATETIME + DATETIME_PICKER_END;
 			}
 			else if (m_sequence % 5 == 1)	// 106,111,116
 			{
 				// Plus 1 year
-				if (m_JP_EU_US == 0)
-				{
-					commandIndex = 137;
-					m_endIndex = 142;
-				}
-				else
-				{
-					commandIndex = 135;
-					m_endIndex = 142;
-				}
+				commandIndex = DATETIME + DATETIME_PLUS_YEAR(m_JP_EU_US);
+				m_endIndex = DATETIME + DATETIME_CONFIRM_END;
 			}
 			else if (m_sequence % 5 == 2)	// 107,112,117
 			{
 				// Back to game and quit raid
-				commandIndex = 143;
-				m_endIndex = 150;
+				commandIndex = DATETIME + DATETIME_BACK;
+				m_endIndex = 148;
 			}
 		}
 		// ------------------------------------------------
@@ -394,33 +331,37 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 		else if (m_sequence == 201)
     {
 			// Press home and move up
-			commandIndex = 165;
-			m_endIndex = 169;
+			commandIndex = 163;
+			m_endIndex = 167;
     }
     else if (m_sequence == 202)
 		{
 			// Goto profile 1 to 10's add friend
-			commandIndex = 190 - m_profile * 2;
-			m_endIndex = 193;
+			commandIndex = 188 - m_profile * 2;
+			m_endIndex = 191;
 		}
 		else if (m_sequence >= 203 && m_sequence <= 287)
 		{
 			// Spam A
-			commandIndex = 194;
-			m_endIndex = 195;
+			commandIndex = 192;
+			m_endIndex = 193;
 		}
 		else if (m_sequence == 288)
 		{
 			// Back to game
-			commandIndex = 196;
-			m_endIndex = 199;
+			commandIndex = 194;
+			m_endIndex = 197;
 
 			// Ready and start raid
 			m_sequence = 27;
 		}
+
+		// Report the newly selected sequence
+		Telemetry_Sequence(commandIndex, m_endIndex);
 	}
 
 	memcpy_P(&tempCommand, &(m_command[commandIndex]), sizeof(Command));
+	Timing_Apply(&tempCommand);
 	switch (tempCommand.button)
 	{
 		case UP:
@@ -473,6 +414,14 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 			ReportData->Button |= SWITCH_A;
 			break;
 
+		case A_SPAM:
+			// A every other pair of reports
+			if (durationCount & 2)
+			{
+				ReportData->Button |= SWITCH_A;
+			}
+			break;
+
 		case B:
 			ReportData->Button |= SWITCH_B;
 			break;
@@ -532,8 +481,8 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 	if (commandIndex == 4)
 	{
 		tempCommand.duration = m_internetTime;
-	} else if (commandIndex == 66 && m_titleScreenBuffer) {
-    tempCommand.duration = 1000;
+	} else if (commandIndex == SOFTRESET + SOFTRESET_BOOT && m_titleScreenBuffer) {
+    tempCommand.duration += SOFTRESET_TITLE_BUFFER;
   }
 
 	if (durationCount > tempCommand.duration)
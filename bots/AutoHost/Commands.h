@@ -1,5 +1,11 @@
 #include "../Joystick.h"
 #include <avr/pgmspace.h>
+#include "DateTime.h"
+#include "SoftReset.h"
+
+// Where DATETIME_COMMANDS and SOFTRESET_COMMANDS are in m_command
+#define DATETIME 91
+#define SOFTRESET 59
 
 static const Command m_command[] PROGMEM = {
 	//----------Setup [0,2]----------
@@ -27,7 +33,7 @@ static const Command m_command[] PROGMEM = {
 	{A, 30},			// (Optional) You can't catch this Pokemon, Is that OK?
 	{NOTHING, 1},
 	{A, 2660},			// (2660 ~= until 2 min)
-	{NOTHING, 2510},	// 2660 + 2510 = 5170 ~= until 1 min
+	{WAIT, 2510},		// 2660 + 2510 = 5170 ~= until 1 min
 
 	{UP, 1},
 	{NOTHING, 1},
@@ -41,6 +47,8 @@ static const Command m_command[] PROGMEM = {
 	{NOTHING, 19},	// Wait until raid starts (between standing up to show abilities)
 
 	//----------Set Link Code [27,56]----------
+	// The digits are entered one move at a time (see GetLinkCodeInput) with
+	// the DOWN [29-30], A [35-36], UP [37-38], LEFT [43-44] and RIGHT [51-52] pairs
 	// Init
 	{PLUS, 40},
 	{NOTHING, 1},
@@ -83,21 +91,12 @@ static const Command m_command[] PROGMEM = {
 	{A, 1},
 	{NOTHING, 30},
 
-	//----------Soft-reset [57,68]----------
+	//----------Soft-reset [57,66]----------
 	{HOME, 1},
 	{NOTHING, 45},
-	{X, 1},			// Close game
-	{NOTHING, 8},
-	{A, 1},			// Comfirm close game
-	{NOTHING, 120},
-	{A, 1},			// Choose game
-	{NOTHING, 50},
-	{A, 1},			// Pick User
-	{NOTHING, 800},
-	{A, 1},			// Enter game
-	{NOTHING, 460},
+	SOFTRESET_COMMANDS,
 
-	//----------Unsafe invite local friend [69,92]----------
+	//----------Unsafe invite local friend [67,90]----------
 	{HOME, 1},
 	{NOTHING, 40},
 	{UP, 1},
@@ -125,84 +124,17 @@ static const Command m_command[] PROGMEM = {
 	{A, 1},				// Error message
 	{NOTHING, 900},		// Wait until exit raid
 
-	// COPY FROM Auto3DaySkipper
-	//----------Sync and unsync time, goto change date [93,137]----------
-	// To System Settings
-	{HOME, 1},
-	{NOTHING, 30},
-	{DOWN, 1},
-	{NOTHING, 1},
-	{RIGHT, 1},
-	{NOTHING, 1},       // NSO home button added in ver 11.0 
-	{RIGHT, 1},         // NSO home button added in ver 11.0
-	{NOTHING, 1},       // NSO home button added in ver 11.0
-	{RRIGHT, 1},
-	{RIGHT, 1},
-	{RRIGHT, 1},
-	{A, 40}, 
-
-	// To Date and Time
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{A, 12},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{A, 1},
-	{NOTHING, 12}, 
-
-	// Sync and unsync time 
-	{A, 1},
-	{NOTHING, 4},
-	{A, 1},
-	{NOTHING, 8}, 
-
-	//----------Plus 1 year [131,142]----------
-	// To actually Date and Time
-	{DOWN, 1}, 
-	{RDOWN, 1},
-	{A, 1},
-	{NOTHING, 7},
-
-	// Plus 1 year
-	{RIGHT_A, 1},		// EU/US start
-	{NOTHING, 1},
-	{UP_A, 1},		// JP start
-	{RRIGHT, 1},
-  {RIGHT_A, 1},
-  {RRIGHT, 1},
-	{A, 1},
-	{NOTHING, 4}, 
-
-	//----------Back to game [143,146]----------
-	
-	{HOME, 1},
-	{NOTHING, 30},
-	{HOME, 1},
-	{NOTHING, 30}, 
+	//----------Sync and unsync time, plus 1 year, back to game [91,144]----------
+	DATETIME_COMMANDS(DOWN, 8),
 
-	//----------Quit the raid [147,150]----------
+	//----------Quit the raid [145,148]----------
 	
 	{B, 32},
 	{NOTHING, 1},
 	{A, 200},		// WAITING on local communication
 	{NOTHING, 1},
 
-	//----------Collect Watts [151,160]----------
+	//----------Collect Watts [149,158]----------
 	{A, 20},		// Talk 
 	{NOTHING, 1},
 	{A, 6},			// There's energy pouring out from the den!
@@ -214,12 +146,12 @@ static const Command m_command[] PROGMEM = {
 	{A, 120},		// WAITING on local communication
 	{NOTHING, 1}, 
 
-	//----------Goto profile [161,190]----------
+	//----------Goto profile [159,188]----------
 	
 	{A, 30},		// (Optional) You can't catch this Pokemon, Is that OK?
 	{NOTHING, 1},
 	{A, 1000},			// Wait 20 seconds
-	{NOTHING, 2510},	// Wait extra 60 seconds (for 2 minute wait)
+	{WAIT, 2510},		// Wait extra 60 seconds (for 2 minute wait)
 
 	{NOTHING, 1}, 
 	{HOME, 1},
@@ -227,7 +159,7 @@ static const Command m_command[] PROGMEM = {
 	{UP, 1},
 	{NOTHING, 1},
 
-	// 10 profiles maximum [170,193]
+	// 10 profiles maximum [168,191]
 	
 	{RIGHT, 1}, 
 	{NOTHING, 1},
@@ -255,11 +187,11 @@ static const Command m_command[] PROGMEM = {
 	{UP, 1},			// Add friend
 	{NOTHING, 8},       
 
-	//----------A Spam [194,195]----------
+	//----------A Spam [192,193]----------
 	{A, 1},
 	{NOTHING, 9},
 
-	//----------Back to game [196,199]----------
+	//----------Back to game [194,197]----------
 	
 	{HOME, 1},
 	{NOTHING, 30},
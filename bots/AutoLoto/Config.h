@@ -1,2 +1,2 @@
-uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
-unsigned int m_dayToSkip = 0; // Optional max days to skip (max 65535)
+static const uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
+static const unsigned int m_dayToSkip = 0; // Optional max days to skip (max 65535)
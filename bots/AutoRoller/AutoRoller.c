@@ -22,116 +22,6 @@ these buttons for our use.
 #include "Commands.h"
 #include "Config.h"
 
-// Main entry point.
-int main(void) {
-	// We'll start by performing hardware and peripheral setup.
-	SetupHardware();
-	// We'll then enable global interrupts for our use.
-	GlobalInterruptEnable();
-	// Once that's done, we'll enter an infinite loop.
-	for (;;)
-	{
-		// We need to run our task to process and deliver data for our IN and OUT endpoints.
-		HID_Task();
-		// We also need to run the main USB management task.
-		USB_USBTask();
-	}
-}
-
-// Configures hardware and peripherals, such as the USB peripherals.
-void SetupHardware(void) {
-	// We need to disable watchdog if enabled by bootloader/fuses.
-	MCUSR &= ~(1 << WDRF);
-	wdt_disable();
-
-	// We need to disable clock division before initializing the USB hardware.
-	//clock_prescale_set(clock_div_1);
-	// We can then initialize our hardware and peripherals, including the USB stack.
-
-	#ifdef ALERT_WHEN_DONE
-	// Both PORTD and PORTB will be used for the optional LED flashing and buzzer.
-	#warning LED and Buzzer functionality enabled. All pins on both PORTB and \
-PORTD will toggle when printing is done.
-	DDRD  = 0xFF; //Teensy uses PORTD
-	PORTD =  0x0;
-                  //We'll just flash all pins on both ports since the UNO R3
-	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
-	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
-	#endif
-	// The USB stack should be initialized last.
-	USB_Init();
-}
-
-// Fired to indicate that the device is enumerating.
-void EVENT_USB_Device_Connect(void) {
-	// We can indicate that we're enumerating here (via status LEDs, sound, etc.).
-}
-
-// Fired to indicate that the device is no longer connected to a host.
-void EVENT_USB_Device_Disconnect(void) {
-	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
-}
-
-// Fired when the host set the current configuration of the USB device after enumeration.
-void EVENT_USB_Device_ConfigurationChanged(void) {
-	bool ConfigSuccess = true;
-
-	// We setup the HID report endpoints.
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-
-	// We can read ConfigSuccess to indicate a success or failure at this point.
-}
-
-// Process control requests sent to the device from the USB host.
-void EVENT_USB_Device_ControlRequest(void) {
-	// We can handle two control requests: a GetReport and a SetReport.
-
-	// Not used here, it looks like we don't receive control request from the Switch.
-}
-
-// Process and deliver data from IN and OUT endpoints.
-void HID_Task(void) {
-	// If the device isn't connected and properly configured, we can't do anything here.
-	if (USB_DeviceState != DEVICE_STATE_Configured)
-		return;
-
-	// We'll start with the OUT endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
-	// We'll check to see if we received something on the OUT endpoint.
-	if (Endpoint_IsOUTReceived())
-	{
-		// If we did, and the packet has data, we'll react to it.
-		if (Endpoint_IsReadWriteAllowed())
-		{
-			// We'll create a place to store our data received from the host.
-			USB_JoystickReport_Output_t JoystickOutputData;
-			// We'll then take in that data, setting it up in our storage.
-			while(Endpoint_Read_Stream_LE(&JoystickOutputData, sizeof(JoystickOutputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-			// At this point, we can react to this data.
-
-			// However, since we're not doing anything with this data, we abandon it.
-		}
-		// Regardless of whether we reacted to the data, we acknowledge an OUT packet on this endpoint.
-		Endpoint_ClearOUT();
-	}
-
-	// We'll then move on to the IN endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
-	// We first check to see if the host is ready to accept data.
-	if (Endpoint_IsINReady())
-	{
-		// We'll create an empty report.
-		USB_JoystickReport_Input_t JoystickInputData;
-		// We'll then populate this report with what we want to send to the host.
-		GetNextReport(&JoystickInputData);
-		// Once populated, we can output this data to the host. We do this by first writing the data to the control stream.
-		while(Endpoint_Write_Stream_LE(&JoystickInputData, sizeof(JoystickInputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-		// We then send an IN packet on this endpoint.
-		Endpoint_ClearIN();
-	}
-}
-
 typedef enum {
 	PROCESS,
 	DONE
@@ -181,47 +71,34 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
         if (m_numSkips == 20)
         {
           m_numSkips = -1;
-          commandIndex = 3;
-          m_endIndex = 37;
+          commandIndex = DATETIME + DATETIME_SETTINGS;
+          m_endIndex = DATETIME + DATETIME_SYNC_END;
           m_sequence--;
         }
         else if (m_numSkips == -1)
         {
           m_numSkips += 1;
-          commandIndex = 50;
-          m_endIndex = 53;
+          commandIndex = DATETIME + DATETIME_BACK;
+          m_endIndex = DATETIME + DATETIME_BACK_END;
           m_sequence--;
         }
         else if (m_sequence == 1)
 				{
 					// Sync and unsync time
-					commandIndex = 3;
-					m_endIndex = 37;
+					commandIndex = DATETIME + DATETIME_SETTINGS;
+					m_endIndex = DATETIME + DATETIME_SYNC_END;
 				}
 				else if (m_sequence == 2)
 				{
 					// Back to game after resetting time
-					commandIndex = 50;
-					m_endIndex = 53;
+					commandIndex = DATETIME + DATETIME_BACK;
+					m_endIndex = DATETIME + DATETIME_BACK_END;
 				}
 				else if (m_daysToSkip && (m_sequence == (m_daysToSkip * 5 + 3)))
 				{
-					// Done skipping days, user should check the pokemon
-					commandIndex = 68;
-					m_endIndex = 103;
-				}
-				else if (m_daysToSkip && (m_sequence == (m_daysToSkip * 5 + 4)))
-				{
-					// see if we need to wait a bit longer for the game to start up
-					if (m_titleScreenBuffer)
-					{
-						commandIndex = 104; // do the extra wait
-					}
-					else
-					{
-						commandIndex = 105; // skip the extra wait
-					}
-					m_endIndex = 106;
+					// Done skipping days, user should check the pokemon, then soft reset
+					commandIndex = 71;
+					m_endIndex = SOFTRESET + SOFTRESET_END;
 					m_sequence = 0;
           m_numSkips = 0;
 				}
@@ -231,50 +108,52 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					if (m_sequence == 3)
 					{
 						// this is the first time we are entering the den, don't collect watts
-						commandIndex = 62;
+						commandIndex = 65;
 					}
 					else
 					{
-						commandIndex = 58;
+						commandIndex = 61;
 					}
-					m_endIndex = 67;
+					m_endIndex = 70;
 				}
 				else if (m_sequence % 5 == 4)	// 4,9,14
 				{
 					// Goto date and time 1
-					commandIndex = 3;
-					m_endIndex = 33;
+					commandIndex = DATETIME + DATETIME_SETTINGS;
+					m_endIndex = DATETIME + DATETIME_SETTINGS_END;
 				}
 				else if (m_sequence % 5 == 0)	// 5,10,15
 				{
 					// Goto date and time 2
-					commandIndex = 38;
-					m_endIndex = 41;
+					commandIndex = DATETIME + DATETIME_PICKER;
+					m_endIndex = DATETIME + DATETIME_PICKER_END;
 				}
 				else if (m_sequence % 5 == 1)	// 6,11,16
 				{
 					// Plus 1 year
-					if (m_JP_EU_US == 0)
-					{
-						commandIndex = 44;
-						m_endIndex = 47;
-					}
-					else
-					{
-						commandIndex = 42;
-						m_endIndex = 47;
-					}
+					commandIndex = DATETIME + DATETIME_PLUS_YEAR(m_JP_EU_US);
+					m_endIndex = DATETIME + DATETIME_PLUS_YEAR_END;
 				}
 				else if (m_sequence % 5 == 2)	// 7,12,17
 				{
 					// Back to game and quit raid
-					commandIndex = 48;
-					m_endIndex = 57;
+					commandIndex = DATETIME + DATETIME_CONFIRM;
+					m_endIndex = 60;
           m_numSkips += 1;
+					Telemetry_Loop();
 				}
+
+				// Report the newly selected sequence
+				Telemetry_Sequence(commandIndex, m_endIndex);
 			}
 
 			memcpy_P(&tempCommand, &(m_command[commandIndex]), sizeof(Command));
+			Timing_Apply(&tempCommand);
+			if (commandIndex == SOFTRESET + SOFTRESET_BOOT && m_titleScreenBuffer)
+			{
+				// Wait longer for a slow title screen
+				tempCommand.duration += SOFTRESET_TITLE_BUFFER;
+			}
 			switch (tempCommand.button)
 			{
 				case UP:
@@ -327,6 +206,14 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					ReportData->Button |= SWITCH_A;
 					break;
 
+				case A_SPAM:
+					// A every other pair of reports
+					if (durationCount & 2)
+					{
+						ReportData->Button |= SWITCH_A;
+					}
+					break;
+
 				case B:
 					ReportData->Button |= SWITCH_B;
 					break;
@@ -1,5 +1,11 @@
 #include "../Joystick.h"
 #include <avr/pgmspace.h>
+#include "DateTime.h"
+#include "SoftReset.h"
+
+// Where DATETIME_COMMANDS and SOFTRESET_COMMANDS are in m_command
+#define DATETIME 3
+#define SOFTRESET 99
 
 static const Command m_command[] PROGMEM = {
 	//----------Setup [0,2]----------
@@ -8,78 +14,16 @@ static const Command m_command[] PROGMEM = {
 	{B, 1},
 	{NOTHING, 1},
 
-	//----------Sync and unsync time, goto change date [3,25][3,37]----------
-	// To System Settings
-	{HOME, 1},
-	{NOTHING, 30},
-	{DOWN, 1},
-	{NOTHING, 1},
-	{RIGHT, 1},
-	{RRIGHT, 1},
-	{RIGHT, 1},
-	{RRIGHT, 1},
-	{A, 40},
-
-	// To Date and Time
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{A, 12},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{A, 1},
-	{NOTHING, 12},
-
-	// Sync and unsync time
-	{A, 1},
-	{NOTHING, 4},
-	{A, 1},
-	{NOTHING, 8},
-
-	//----------Plus 1 year [26,37][38,49]----------
-	// To actually Date and Time
-	{DOWN, 1},
-	{RDOWN, 1},
-	{A, 1},
-	{NOTHING, 7},
-
-	// Plus 1 year
-	{RIGHT_A, 1},		// EU/US start
-	{NOTHING, 1},
-	{UP_A, 1},		// JP start
-	{RRIGHT, 1},
-  {RIGHT_A, 1},
-  {RRIGHT, 1},
-	{A, 1},
-	{NOTHING, 4},
-
-	//----------Back to game [38,41][50,53]----------
-	{HOME, 1},
-	{NOTHING, 30},
-	{HOME, 1},
-	{NOTHING, 30},
+	//----------Sync and unsync time, plus 1 year, back to game [3,56]----------
+	DATETIME_COMMANDS(DOWN, 8),
 
-	//----------Quit the raid [42,45][54,57]----------
+	//----------Quit the raid [57,60]----------
 	{B, 32},
 	{NOTHING, 1},
 	{A, 200},		// WAITING on local communication
 	{NOTHING, 1},
 
-	//----------Collect Watts [46,53][58,67]----------
+	//----------Collect Watts [61,70]----------
 	{A, 20},		// Talk
 	{NOTHING, 1},
 	{A, 6},			// There's energy pouring out from the den!
@@ -91,7 +35,7 @@ static const Command m_command[] PROGMEM = {
 	{A, 120},		// WAITING on local communication
 	{NOTHING, 1},
 
-	//----------Ring bike like mad, collect watts then delay [54,79][66,91]----------
+	//----------Ring bike like mad, collect watts then delay [71,96]----------
 	{LCLICK, 1},
 	{NOTHING, 10},
 	{LCLICK, 1},
@@ -119,18 +63,8 @@ static const Command m_command[] PROGMEM = {
 	{A, 30},		// You gained 2,000W! (Delay longer for player to check)
 	{NOTHING, 300},
 
-	//----------Finish/Prepare SR [80,92][92,104]----------
+	//----------Finish/Prepare SR [97,106]----------
 	{HOME, 1},
 	{NOTHING, 40},
-	{X, 1},			// Close game
-	{NOTHING, 8},
-	{A, 1},			// Comfirm close game
-	{NOTHING, 120},
-	{A, 1},			// Choose game
-	{NOTHING, 50},
-	{A, 1},			// Pick User
-	{NOTHING, 800},
-	{NOTHING, 280}, // Extra wait time if m_titleScreenBuffer is true
-	{A, 1},			// Enter game
-	{NOTHING, 460}
+	SOFTRESET_COMMANDS
 };
@@ -1,3 +1,3 @@
-uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
-bool m_titleScreenBuffer = true; // Set this to true if the title screen takes long to load
-uint16_t m_daysToSkip = 3;
+static const uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
+static const bool m_titleScreenBuffer = true; // Set this to true if the title screen takes long to load
+static const uint16_t m_daysToSkip = 3;
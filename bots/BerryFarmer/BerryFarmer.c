@@ -20,118 +20,9 @@ these buttons for our use.
 
 #include "../Joystick.h"
 #include "Commands.h"
+#include "SavePolicy.h"
 #include "Config.h"
 
-// Main entry point.
-int main(void) {
-	// We'll start by performing hardware and peripheral setup.
-	SetupHardware();
-	// We'll then enable global interrupts for our use.
-	GlobalInterruptEnable();
-	// Once that's done, we'll enter an infinite loop.
-	for (;;)
-	{
-		// We need to run our task to process and deliver data for our IN and OUT endpoints.
-		HID_Task();
-		// We also need to run the main USB management task.
-		USB_USBTask();
-	}
-}
-
-// Configures hardware and peripherals, such as the USB peripherals.
-void SetupHardware(void) {
-	// We need to disable watchdog if enabled by bootloader/fuses.
-	MCUSR &= ~(1 << WDRF);
-	wdt_disable();
-
-	// We need to disable clock division before initializing the USB hardware.
-	//clock_prescale_set(clock_div_1);
-	// We can then initialize our hardware and peripherals, including the USB stack.
-
-	#ifdef ALERT_WHEN_DONE
-	// Both PORTD and PORTB will be used for the optional LED flashing and buzzer.
-	#warning LED and Buzzer functionality enabled. All pins on both PORTB and \
-PORTD will toggle when printing is done.
-	DDRD  = 0xFF; //Teensy uses PORTD
-	PORTD =  0x0;
-                  //We'll just flash all pins on both ports since the UNO R3
-	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
-	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
-	#endif
-	// The USB stack should be initialized last.
-	USB_Init();
-}
-
-// Fired to indicate that the device is enumerating.
-void EVENT_USB_Device_Connect(void) {
-	// We can indicate that we're enumerating here (via status LEDs, sound, etc.).
-}
-
-// Fired to indicate that the device is no longer connected to a host.
-void EVENT_USB_Device_Disconnect(void) {
-	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
-}
-
-// Fired when the host set the current configuration of the USB device after enumeration.
-void EVENT_USB_Device_ConfigurationChanged(void) {
-	bool ConfigSuccess = true;
-
-	// We setup the HID report endpoints.
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-
-	// We can read ConfigSuccess to indicate a success or failure at this point.
-}
-
-// Process control requests sent to the device from the USB host.
-void EVENT_USB_Device_ControlRequest(void) {
-	// We can handle two control requests: a GetReport and a SetReport.
-
-	// Not used here, it looks like we don't receive control request from the Switch.
-}
-
-// Process and deliver data from IN and OUT endpoints.
-void HID_Task(void) {
-	// If the device isn't connected and properly configured, we can't do anything here.
-	if (USB_DeviceState != DEVICE_STATE_Configured)
-		return;
-
-	// We'll start with the OUT endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
-	// We'll check to see if we received something on the OUT endpoint.
-	if (Endpoint_IsOUTReceived())
-	{
-		// If we did, and the packet has data, we'll react to it.
-		if (Endpoint_IsReadWriteAllowed())
-		{
-			// We'll create a place to store our data received from the host.
-			USB_JoystickReport_Output_t JoystickOutputData;
-			// We'll then take in that data, setting it up in our storage.
-			while(Endpoint_Read_Stream_LE(&JoystickOutputData, sizeof(JoystickOutputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-			// At this point, we can react to this data.
-
-			// However, since we're not doing anything with this data, we abandon it.
-		}
-		// Regardless of whether we reacted to the data, we acknowledge an OUT packet on this endpoint.
-		Endpoint_ClearOUT();
-	}
-
-	// We'll then move on to the IN endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
-	// We first check to see if the host is ready to accept data.
-	if (Endpoint_IsINReady())
-	{
-		// We'll create an empty report.
-		USB_JoystickReport_Input_t JoystickInputData;
-		// We'll then populate this report with what we want to send to the host.
-		GetNextReport(&JoystickInputData);
-		// Once populated, we can output this data to the host. We do this by first writing the data to the control stream.
-		while(Endpoint_Write_Stream_LE(&JoystickInputData, sizeof(JoystickInputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-		// We then send an IN packet on this endpoint.
-		Endpoint_ClearIN();
-	}
-}
-
 typedef enum {
 	PROCESS,
 	DONE
@@ -150,8 +41,10 @@ int commandIndex = 0;
 int m_endIndex = 2;
 int m_sequence = 0;
 
-// Saving
-int m_saveCount = 0;
+// Save as rarely as the farming time we can lose allows.
+void SetupBot(void) {
+	SavePolicy_Init(m_maxLossMinutes);
+}
 
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
@@ -180,50 +73,49 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 			if (commandIndex == -1)
 			{
 				m_sequence++;
+				if (m_sequence == 4 && !SavePolicy_Collected())
+				{
+					// Not time to save yet
+					m_sequence = 1;
+				}
+				else if (m_sequence == 5)
+				{
+					SavePolicy_Saved();
+					m_sequence = 1;
+				}
+
 				if (m_sequence == 1)
 				{
 					// sync and unsync time
-					commandIndex = 3;
-					m_endIndex = 40;
+					commandIndex = DATETIME + DATETIME_SETTINGS;
+					m_endIndex = DATETIME + DATETIME_PICKER_END;
 				}
 				else if (m_sequence == 2)
 				{
 					// Plus 1 year
-					if (m_JP_EU_US == 0)
-					{
-						commandIndex = 43;
-						m_endIndex = 48;
-					}
-					else
-					{
-						commandIndex = 41;
-						m_endIndex = 48;
-					}
+					commandIndex = DATETIME + DATETIME_PLUS_YEAR(m_JP_EU_US);
+					m_endIndex = DATETIME + DATETIME_CONFIRM_END;
 				}
 				else if (m_sequence == 3)
 				{
 					// collect berries
-					commandIndex = 49;
-					m_endIndex = 70;
-
-					m_saveCount++;
-					if (m_saveCount != m_saveAt)
-					{
-						m_sequence = 0;
-					}
+					commandIndex = DATETIME + DATETIME_BACK;
+					m_endIndex = 74;
+					Telemetry_Loop();
 				}
 				else if (m_sequence == 4)
 				{
 					// save game
-					commandIndex = 71;
-					m_endIndex = 76;
-
-					m_saveCount = 0;
-					m_sequence = 0;
+					commandIndex = 75;
+					m_endIndex = 80;
 				}
+
+				// Report the newly selected sequence
+				Telemetry_Sequence(commandIndex, m_endIndex);
 			}
 
 			memcpy_P(&tempCommand, &(m_command[commandIndex]), sizeof(Command));
+			Timing_Apply(&tempCommand);
 			switch (tempCommand.button)
 			{
 				case UP:
@@ -1,5 +1,9 @@
 #include "../Joystick.h"
 #include <avr/pgmspace.h>
+#include "DateTime.h"
+
+// Where DATETIME_COMMANDS is in m_command
+#define DATETIME 3
 
 static const Command m_command[] PROGMEM = {
 	//----------Setup [0,2]----------
@@ -8,70 +12,10 @@ static const Command m_command[] PROGMEM = {
 	{B, 1},
 	{NOTHING, 1},
 
-	//----------Sync and unsync time, goto change date [3,40]----------
-	// To System Settings [3,11]
-	{HOME, 1},
-	{NOTHING, 30},
-	{DOWN, 1},
-	{NOTHING, 1},
-	{RIGHT, 1},
-	{RRIGHT, 1},
-	{RIGHT, 1},
-	{RRIGHT, 1},
-	{A, 40},
-
-	// To Date and Time [12,32]
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{A, 12},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{DOWN, 1},
-	{RDOWN, 1},
-	{A, 1},
-	{NOTHING, 12},
-
-	// Sync and unsync time [33,36]
-	{A, 1},
-	{NOTHING, 4},
-	{A, 1},
-	{NOTHING, 12},
-
-	// To actually Date and Time [37,40]
-	{DOWN, 1},
-	{RDOWN, 1},
-	{A, 1},
-	{NOTHING, 7},
-
-	//----------Plus 1 year [41,48]----------
-	{RIGHT_A, 1},		// EU/US start
-	{NOTHING, 1},
-	{UP_A, 1},		// JP start
-	{RRIGHT, 1},
-  {RIGHT_A, 1},
-  {RRIGHT, 1},
-	{A, 1},
-	{NOTHING, 4},
-
-	//----------Back to game [49,52]----------
-	{HOME, 1},
-	{NOTHING, 30},
-	{HOME, 1},
-	{NOTHING, 30},
+	//----------Sync and unsync time, plus 1 year, back to game [3,56]----------
+	DATETIME_COMMANDS(NOTHING, 12),
 
-	//----------Collect Berry [53,70]----------
+	//----------Collect Berry [57,74]----------
 	{A, 16},		// It's a Berry tree. Do you want to shake it?
 	{NOTHING, 1},
 	{A, 12},
@@ -91,7 +35,7 @@ static const Command m_command[] PROGMEM = {
 	{B, 16},
 	{NOTHING, 14},
 
-	//----------Save Game [71,76]----------
+	//----------Save Game [75,80]----------
 	{X, 1},
 	{NOTHING, 20},
 	{R, 1},
@@ -1 +1,3 @@
-int m_boxCount = 2; // Number of boxes to release
+static const int m_boxCount = 2; // Number of boxes to release
+static const bool m_resumeProgress = true; // Resume from the last box after a power loss
+static const uint8_t m_lastBoxCount = 30; // Pokemon in the last box, the empty slots after them are skipped
@@ -22,116 +22,6 @@ these buttons for our use.
 #include "Commands.h"
 #include "Config.h"
 
-// Main entry point.
-int main(void) {
-	// We'll start by performing hardware and peripheral setup.
-	SetupHardware();
-	// We'll then enable global interrupts for our use.
-	GlobalInterruptEnable();
-	// Once that's done, we'll enter an infinite loop.
-	for (;;)
-	{
-		// We need to run our task to process and deliver data for our IN and OUT endpoints.
-		HID_Task();
-		// We also need to run the main USB management task.
-		USB_USBTask();
-	}
-}
-
-// Configures hardware and peripherals, such as the USB peripherals.
-void SetupHardware(void) {
-	// We need to disable watchdog if enabled by bootloader/fuses.
-	MCUSR &= ~(1 << WDRF);
-	wdt_disable();
-
-	// We need to disable clock division before initializing the USB hardware.
-	//clock_prescale_set(clock_div_1);
-	// We can then initialize our hardware and peripherals, including the USB stack.
-
-	#ifdef ALERT_WHEN_DONE
-	// Both PORTD and PORTB will be used for the optional LED flashing and buzzer.
-	#warning LED and Buzzer functionality enabled. All pins on both PORTB and \
-PORTD will toggle when printing is done.
-	DDRD  = 0xFF; //Teensy uses PORTD
-	PORTD =  0x0;
-                  //We'll just flash all pins on both ports since the UNO R3
-	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
-	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
-	#endif
-	// The USB stack should be initialized last.
-	USB_Init();
-}
-
-// Fired to indicate that the device is enumerating.
-void EVENT_USB_Device_Connect(void) {
-	// We can indicate that we're enumerating here (via status LEDs, sound, etc.).
-}
-
-// Fired to indicate that the device is no longer connected to a host.
-void EVENT_USB_Device_Disconnect(void) {
-	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
-}
-
-// Fired when the host set the current configuration of the USB device after enumeration.
-void EVENT_USB_Device_ConfigurationChanged(void) {
-	bool ConfigSuccess = true;
-
-	// We setup the HID report endpoints.
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-
-	// We can read ConfigSuccess to indicate a success or failure at this point.
-}
-
-// Process control requests sent to the device from the USB host.
-void EVENT_USB_Device_ControlRequest(void) {
-	// We can handle two control requests: a GetReport and a SetReport.
-
-	// Not used here, it looks like we don't receive control request from the Switch.
-}
-
-// Process and deliver data from IN and OUT endpoints.
-void HID_Task(void) {
-	// If the device isn't connected and properly configured, we can't do anything here.
-	if (USB_DeviceState != DEVICE_STATE_Configured)
-		return;
-
-	// We'll start with the OUT endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
-	// We'll check to see if we received something on the OUT endpoint.
-	if (Endpoint_IsOUTReceived())
-	{
-		// If we did, and the packet has data, we'll react to it.
-		if (Endpoint_IsReadWriteAllowed())
-		{
-			// We'll create a place to store our data received from the host.
-			USB_JoystickReport_Output_t JoystickOutputData;
-			// We'll then take in that data, setting it up in our storage.
-			while(Endpoint_Read_Stream_LE(&JoystickOutputData, sizeof(JoystickOutputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-			// At this point, we can react to this data.
-
-			// However, since we're not doing anything with this data, we abandon it.
-		}
-		// Regardless of whether we reacted to the data, we acknowledge an OUT packet on this endpoint.
-		Endpoint_ClearOUT();
-	}
-
-	// We'll then move on to the IN endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
-	// We first check to see if the host is ready to accept data.
-	if (Endpoint_IsINReady())
-	{
-		// We'll create an empty report.
-		USB_JoystickReport_Input_t JoystickInputData;
-		// We'll then populate this report with what we want to send to the host.
-		GetNextReport(&JoystickInputData);
-		// Once populated, we can output this data to the host. We do this by first writing the data to the control stream.
-		while(Endpoint_Write_Stream_LE(&JoystickInputData, sizeof(JoystickInputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-		// We then send an IN packet on this endpoint.
-		Endpoint_ClearIN();
-	}
-}
-
 typedef enum {
 	PROCESS,
 	DONE
@@ -155,6 +45,25 @@ uint8_t m_box = 1;
 uint8_t m_column = 1;
 uint8_t m_row = 1;
 
+// Progress kept in an EEPROM checkpoint
+typedef struct {
+	uint8_t box;
+	uint8_t column;
+	uint8_t row;
+} Progress_t;
+
+// Resume from the next trade after the bot was interrupted.
+void SetupBot(void) {
+	Progress_t progress;
+	CHECKPOINT_ASSERT_SIZE(progress);
+	if (m_resumeProgress && Checkpoint_Load(&progress, sizeof(Progress_t)))
+	{
+		m_box = progress.box;
+		m_column = progress.column;
+		m_row = progress.row;
+	}
+}
+
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 
@@ -183,7 +92,7 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 			{
 				m_sequence++;
 
-				if (m_endIndex == 52)
+				if (m_endIndex == 48)
 				{
 					// FINISH
 					state = DONE;
@@ -194,12 +103,25 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 				{
 					if (m_row == 5 && m_column > 6 && m_box == m_boxesToTrade)
 					{
+						if (m_resumeProgress)
+						{
+							Checkpoint_Clear();
+						}
+
 						// Done, press HOME
-						commandIndex = 51;
-						m_endIndex = 52;
+						commandIndex = 47;
+						m_endIndex = 48;
 					}
 					else
 					{
+						if (m_resumeProgress)
+						{
+							// Every trade so far has been completed
+							Progress_t progress = {m_box, m_column, m_row};
+							CHECKPOINT_ASSERT_SIZE(progress);
+							Checkpoint_Save(&progress, sizeof(Progress_t), false);
+						}
+
 						// Go to box
 						commandIndex = 3;
 						m_endIndex = 6;
@@ -237,14 +159,14 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					if (m_row == 5 && m_column > 6)
 					{
 						// Last pokemon in the box, wait longer
-						commandIndex = 34;
-						m_endIndex = 40;
+						commandIndex = 32;
+						m_endIndex = 36;
 					}
 					else
 					{
 						// Wait for trade
 						commandIndex = 27;
-						m_endIndex = 33;
+						m_endIndex = 31;
 					}
 				}
 				else
@@ -252,20 +174,25 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					// Complete trade
 					if (m_completeDex)
 					{
-						commandIndex = 47;
-						m_endIndex = 50;
+						commandIndex = 43;
+						m_endIndex = 46;
 					}
 					else
 					{
-						commandIndex = 41;
-						m_endIndex = 46;
+						commandIndex = 37;
+						m_endIndex = 42;
 					}
 
 					m_sequence = 0;
+					Telemetry_Loop();
 				}
+
+				// Report the newly selected sequence
+				Telemetry_Sequence(commandIndex, m_endIndex);
 			}
 
 			memcpy_P(&tempCommand, &(m_command[commandIndex]), sizeof(Command));
+			Timing_Apply(&tempCommand);
 			switch (tempCommand.button)
 			{
 				/*case UP:
@@ -300,6 +227,14 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					ReportData->Button |= SWITCH_B;
 					break;
 
+				case B_SPAM:
+					// B every other pair of reports
+					if (durationCount & 2)
+					{
+						ReportData->Button |= SWITCH_B;
+					}
+					break;
+
 				/*case L:
 					ReportData->Button |= SWITCH_L;
 					break;*/
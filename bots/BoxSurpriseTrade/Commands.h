@@ -8,7 +8,7 @@ static const Command m_command[] PROGMEM = {
 	{B, 1},
 	{NOTHING, 1},
 
-	//----------Surprise Trade Sequence [3,50]----------
+	//----------Surprise Trade Sequence [3,46]----------
 	// Goto box [3,6]
 	{Y, 50},
 	{DOWN, 2},
@@ -40,25 +40,21 @@ static const Command m_command[] PROGMEM = {
 	{R, 1},
 	{NOTHING, 14},
 
-	// Wait for trade to complete [27,33]
+	// Wait for trade to complete [27,31]
 	{A, 200},			// Confirm pokemon
 	{NOTHING, 1},
 	{A, 22},			// Start
-	{B, 22},			// Starting to search for another Trainer!
-	{NOTHING, 1},
-	{B, 1},				// You can also cancel your request...
-	{NOTHING, 1300},	// 1300 = wait 30 seconds
+	{B_SPAM, 25},		// Starting to search for another Trainer!, You can also cancel your request...
+	{WAIT, 1300},		// 1300 = wait 30 seconds
 
-	// Wait for trade to complete (long wait for last pokemon) [34,40]
+	// Wait for trade to complete (long wait for last pokemon) [32,36]
 	{A, 200},			// Confirm pokemon
 	{NOTHING, 1},
 	{A, 22},			// Start
-	{B, 22},			// Starting to search for another Trainer!
-	{NOTHING, 1},
-	{B, 1},				// You can also cancel your request...
-	{NOTHING, 2600},	// 2600 = wait 60 seconds
+	{B_SPAM, 25},		// Starting to search for another Trainer!, You can also cancel your request...
+	{WAIT, 2600},		// 2600 = wait 60 seconds
 
-	// Finish trade [41,46]
+	// Finish trade [37,42]
 	{Y, 5},
 	{B, 1000},			// Wait 25 seconds for trade to complete + dex entry
 	{NOTHING, 1},
@@ -66,13 +62,13 @@ static const Command m_command[] PROGMEM = {
 	{NOTHING, 1},
 	{B, 80},			// One extra B for new dex entry
 
-	// Finish trade (no new dex entry wait) [47,50]
+	// Finish trade (no new dex entry wait) [43,46]
 	{Y, 5},				// Wait 23 seconds for trade to complete
 	{B, 930},			// This B press is only for trade evolution
 	{NOTHING, 1},
 	{B, 30},			// Exit y-comm if nothing was traded
 
-	//----------Done [51,52]----------
+	//----------Done [47,48]----------
 	{HOME, 1},
 	{NOTHING, 30},
 };
@@ -1,2 +1,3 @@
-uint8_t m_boxesToTrade = 3; // Number of boxes to trade
-bool m_completeDex = true; // Skip wait time for new Pokedex entries
+static const uint8_t m_boxesToTrade = 3; // Number of boxes to trade
+static const bool m_completeDex = true; // Skip wait time for new Pokedex entries
+static const bool m_resumeProgress = true; // Resume from the last trade after a power loss
@@ -0,0 +1,121 @@
+/*
+Cycle counts for simavr, see Benchmark.h.
+
+The results are written to simavr's console register (GPIOR0), one line per
+timed section plus the stack high-water mark:
+	BENCH <section> worst=<cycles> avg=<cycles>
+	BENCH stack used=<bytes> free=<bytes>
+*/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <avr/avr_mcu_section.h>
+#include "../Joystick.h"
+
+// Tells simavr which part to simulate and where the console is
+AVR_MCU(F_CPU, BENCHMARK_MCU);
+AVR_MCU_SIMAVR_CONSOLE(&GPIOR0);
+
+static const char m_sectionNames[BENCHMARK_COUNT][9] PROGMEM = {
+	"report",
+	"hid_task",
+	"loop",
+};
+
+static uint16_t m_worst[BENCHMARK_COUNT];
+static uint32_t m_total[BENCHMARK_COUNT];
+static uint16_t m_polls = 0;
+
+extern uint8_t _end;
+extern uint8_t __stack;
+
+// Paint the memory between the end of .bss and the top of the stack before
+// anything runs, so the bytes still painted at the end were never used.
+void Benchmark_PaintStack(void) __attribute__((naked, used, section(".init1")));
+void Benchmark_PaintStack(void) {
+	__asm volatile (
+		"    ldi r30, lo8(_end)\n"
+		"    ldi r31, hi8(_end)\n"
+		"    ldi r24, %0\n"
+		"    ldi r25, hi8(__stack)\n"
+		"    rjmp 2f\n"
+		"1:  st Z+, r24\n"
+		"2:  cpi r30, lo8(__stack)\n"
+		"    cpc r31, r25\n"
+		"    brlo 1b\n"
+		"    breq 1b\n"
+		:: "M" (BENCHMARK_STACK_PAINT)
+	);
+}
+
+void Benchmark_Init(void) {
+	TCCR1A = 0;
+	TCCR1B = (1 << CS10);
+}
+
+void Benchmark_End(BenchmarkSection_t section, uint16_t begin) {
+	uint16_t cycles = TCNT1 - begin;
+	if (cycles > m_worst[section])
+	{
+		m_worst[section] = cycles;
+	}
+	m_total[section] += cycles;
+}
+
+static void Console_Write(const char* text) {
+	char c;
+	while ((c = pgm_read_byte(text++)))
+	{
+		GPIOR0 = c;
+	}
+}
+
+static void Console_WriteNumber(uint32_t value) {
+	char digits[10];
+	uint8_t count = 0;
+	do
+	{
+		digits[count++] = '0' + value % 10;
+		value /= 10;
+	} while (value);
+
+	while (count)
+	{
+		GPIOR0 = digits[--count];
+	}
+}
+
+void Benchmark_Poll(void) {
+	if (++m_polls < BENCHMARK_POLLS)
+		return;
+
+	cli();
+
+	for (uint8_t section = 0; section < BENCHMARK_COUNT; section++)
+	{
+		Console_Write(PSTR("BENCH "));
+		Console_Write(m_sectionNames[section]);
+		Console_Write(PSTR(" worst="));
+		Console_WriteNumber(m_worst[section]);
+		Console_Write(PSTR(" avg="));
+		Console_WriteNumber(m_total[section] / BENCHMARK_POLLS);
+		GPIOR0 = '\n';
+	}
+
+	// The stack grows down from __stack, the painted bytes above _end were never reached
+	uint8_t* p = &_end;
+	while (p <= &__stack && *p == BENCHMARK_STACK_PAINT)
+	{
+		p++;
+	}
+	Console_Write(PSTR("BENCH stack used="));
+	Console_WriteNumber(&__stack - p + 1);
+	Console_Write(PSTR(" free="));
+	Console_WriteNumber(p - &_end);
+	GPIOR0 = '\n';
+
+	// Sleeping with interrupts disabled ends the simulation
+	sleep_enable();
+	sleep_cpu();
+}
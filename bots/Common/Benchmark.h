@@ -0,0 +1,52 @@
+/*
+Cycle counts of the report path, for running a bot in simavr. Build with
+BENCH=Y (see tools/simavr_bench.sh); otherwise every call below compiles to
+nothing.
+
+Timer1 runs at clk/1, so the difference between two TCNT1 readings is the
+number of CPU cycles in between (anything timed must take less than 65536
+cycles, 4 ms at 16 MHz). There is no USB host in simavr, so every main loop
+iteration stands for one poll. After BENCHMARK_POLLS polls the results are
+written to the simavr console and the CPU goes to sleep with interrupts
+disabled, which ends the simulation.
+*/
+
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+#include <stdint.h>
+#include <avr/io.h>
+
+#define BENCHMARK_POLLS 20000
+
+// Byte the unused stack is painted with
+#define BENCHMARK_STACK_PAINT 0xC5
+
+// Timed sections
+typedef enum {
+	BENCHMARK_REPORT,    // GetNextReport
+	BENCHMARK_HID_TASK,  // HID_Task
+	BENCHMARK_LOOP,      // one main loop iteration
+	BENCHMARK_COUNT
+} BenchmarkSection_t;
+
+#ifdef BENCHMARK
+// Start Timer1, called from SetupHardware.
+void Benchmark_Init(void);
+
+// Time a section, Begin and End must be paired.
+static inline uint16_t Benchmark_Begin(void) {
+	return TCNT1;
+}
+void Benchmark_End(BenchmarkSection_t section, uint16_t begin);
+
+// Count one poll, and print the results once BENCHMARK_POLLS have been made.
+void Benchmark_Poll(void);
+#else
+static inline void Benchmark_Init(void) {}
+static inline uint16_t Benchmark_Begin(void) { return 0; }
+static inline void Benchmark_End(BenchmarkSection_t section, uint16_t begin) {}
+static inline void Benchmark_Poll(void) {}
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+/*
+Gregorian calendar, see Calendar.h.
+*/
+
+#include <avr/pgmspace.h>
+#include "Calendar.h"
+
+// February is fixed up for leap years
+static const uint8_t m_daysInMonth[12] PROGMEM = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+bool Calendar_IsLeapYear(int year) {
+	if (year % 4 != 0)
+		return false;
+	if (year % 100 != 0)
+		return true;
+	return (year % 400 == 0);
+}
+
+uint8_t Calendar_DaysInMonth(uint8_t month, int year) {
+	if (month == 2 && Calendar_IsLeapYear(year))
+		return 29;
+	return pgm_read_byte(&m_daysInMonth[month - 1]);
+}
+
+Rollover_t Calendar_NextDay(Date_t* date) {
+	if (date->day < Calendar_DaysInMonth(date->month, date->year))
+	{
+		date->day++;
+		return ROLLOVER_DAY;
+	}
+
+	date->day = 1;
+	if (date->month < 12)
+	{
+		date->month++;
+		return ROLLOVER_MONTH;
+	}
+
+	date->month = 1;
+	date->year++;
+	return ROLLOVER_YEAR;
+}
@@ -0,0 +1,39 @@
+/*
+Gregorian calendar shared by the bots that change the Switch's date.
+
+Calendar_NextDay advances a date by one day and tells which field of the
+Switch's date picker has to change for it: only the day, the day rolling over
+into the next month, or the month rolling over into the next year. Bots keep
+their skip sequences in a table indexed by that rollover (and their region's
+layout), so picking the next sequence is a single lookup.
+*/
+
+#ifndef _CALENDAR_H_
+#define _CALENDAR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct {
+	uint8_t day;   // 1 to 31
+	uint8_t month; // 1 to 12
+	int year;
+} Date_t;
+
+typedef enum {
+	ROLLOVER_DAY,   // The day went up by one
+	ROLLOVER_MONTH, // The day went back to 1 and the month up by one
+	ROLLOVER_YEAR,  // The day and month went back to 1 and the year up by one
+	ROLLOVER_COUNT
+} Rollover_t;
+
+// Leap years are divisible by 4, except centuries not divisible by 400.
+bool Calendar_IsLeapYear(int year);
+
+// Number of days in month (1 to 12) of year.
+uint8_t Calendar_DaysInMonth(uint8_t month, int year);
+
+// Move date to the next day, returns which fields changed.
+Rollover_t Calendar_NextDay(Date_t* date);
+
+#endif
@@ -0,0 +1,174 @@
+/*
+Wear-levelled progress checkpoints, see Checkpoint.h.
+
+Each save goes to the slot after the latest one, with the next serial number.
+On boot the slot holding this build's highest serial number with a valid CRC
+and commit byte wins. A checkpoint with no state marks the progress as cleared.
+
+A slot is written commit byte first (cleared), then everything up to the CRC,
+then the commit byte again (set). A write torn by a power loss leaves the
+commit byte cleared, so the slot is ignored even if its CRC happens to match.
+*/
+
+#include <stddef.h>
+#include <avr/io.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+#include <util/delay.h>
+#include "../Joystick.h"
+
+typedef struct {
+	uint16_t build;  // hash of the build date and time
+	uint16_t serial; // incremented at every save
+	uint8_t size;    // 0 once cleared
+	uint8_t state[CHECKPOINT_MAX_SIZE];
+	uint8_t crc;     // CRC-8/CCITT of everything above
+	uint8_t commit;  // CHECKPOINT_COMMITTED once the slot is fully written
+	uint8_t padding;
+} Checkpoint_t;
+
+#define CHECKPOINT_COMMITTED 0xA5
+#define CHECKPOINT_CLEARED   0xFF
+
+// Checkpoint_Task steps: clear the commit byte, write the slot up to its CRC, set the commit byte
+#define CHECKPOINT_STEP_DATA   1
+#define CHECKPOINT_STEP_COMMIT (CHECKPOINT_STEP_DATA + offsetof(Checkpoint_t, commit))
+#define CHECKPOINT_STEP_IDLE   (CHECKPOINT_STEP_COMMIT + 1)
+
+static Checkpoint_t EEMEM m_slots[CHECKPOINT_SLOTS];
+
+static uint16_t m_build;
+static uint8_t m_latestSlot = CHECKPOINT_SLOTS - 1;
+static uint16_t m_latestSerial = 0;
+static uint32_t m_lastSave = 0;
+
+// Checkpoint being written, one byte per Checkpoint_Task
+static Checkpoint_t m_pending;
+static uint8_t m_pendingSlot;
+static uint8_t m_pendingStep = CHECKPOINT_STEP_IDLE;
+
+static uint8_t Checkpoint_CRC(const Checkpoint_t* checkpoint) {
+	const uint8_t* data = (const uint8_t*)checkpoint;
+	uint8_t crc = 0;
+	for (uint8_t i = 0; i < offsetof(Checkpoint_t, crc); i++)
+	{
+		crc = _crc8_ccitt_update(crc, data[i]);
+	}
+	return crc;
+}
+
+static void Checkpoint_Queue(const void* state, uint8_t size) {
+	m_latestSlot = (m_latestSlot + 1) % CHECKPOINT_SLOTS;
+	m_latestSerial++;
+
+	memset(&m_pending, 0, sizeof(Checkpoint_t));
+	m_pending.build = m_build;
+	m_pending.serial = m_latestSerial;
+	m_pending.size = size;
+	if (size)
+	{
+		memcpy(m_pending.state, state, size);
+	}
+	m_pending.crc = Checkpoint_CRC(&m_pending);
+	m_pending.commit = CHECKPOINT_COMMITTED;
+
+	// A save still in progress is abandoned, its slot is left uncommitted
+	m_pendingSlot = m_latestSlot;
+	m_pendingStep = 0;
+}
+
+bool Checkpoint_LoadBuild(const char* build, void* state, uint8_t size) {
+	if (size > CHECKPOINT_MAX_SIZE)
+		return false;
+
+	uint16_t hash = 0xFFFF;
+	char c;
+	while ((c = pgm_read_byte(build++)))
+	{
+		hash = _crc16_update(hash, c);
+	}
+	m_build = hash;
+
+	// Find the latest checkpoint of this build
+	Checkpoint_t checkpoint;
+	bool found = false;
+	for (uint8_t slot = 0; slot < CHECKPOINT_SLOTS; slot++)
+	{
+		eeprom_read_block(&checkpoint, &m_slots[slot], sizeof(Checkpoint_t));
+		if (checkpoint.build != m_build || checkpoint.commit != CHECKPOINT_COMMITTED ||
+			checkpoint.crc != Checkpoint_CRC(&checkpoint))
+			continue;
+
+		if (!found || (int16_t)(checkpoint.serial - m_latestSerial) > 0)
+		{
+			found = true;
+			m_latestSlot = slot;
+			m_latestSerial = checkpoint.serial;
+		}
+	}
+
+	if (!found)
+		return false;
+
+	// Holding the clear pin low at boot discards the checkpoint
+	uint8_t ddr = CHECKPOINT_CLEAR_DDR;
+	uint8_t port = CHECKPOINT_CLEAR_PORT;
+	CHECKPOINT_CLEAR_DDR &= ~(1 << CHECKPOINT_CLEAR_BIT);
+	CHECKPOINT_CLEAR_PORT |= (1 << CHECKPOINT_CLEAR_BIT);
+	_delay_ms(1);
+	bool clear = !(CHECKPOINT_CLEAR_PIN & (1 << CHECKPOINT_CLEAR_BIT));
+	CHECKPOINT_CLEAR_PORT = port;
+	CHECKPOINT_CLEAR_DDR = ddr;
+
+	if (clear)
+	{
+		Checkpoint_Clear();
+		return false;
+	}
+
+	eeprom_read_block(&checkpoint, &m_slots[m_latestSlot], sizeof(Checkpoint_t));
+	if (checkpoint.size != size)
+		return false;
+
+	memcpy(state, checkpoint.state, size);
+	return true;
+}
+
+bool Checkpoint_Save(const void* state, uint8_t size, bool force) {
+	if (size > CHECKPOINT_MAX_SIZE)
+		return false;
+
+	uint32_t uptime = GetUptimeMS();
+	if (!force && uptime - m_lastSave < CHECKPOINT_INTERVAL_MS)
+		return false;
+
+	m_lastSave = uptime;
+	Checkpoint_Queue(state, size);
+	return true;
+}
+
+void Checkpoint_Clear(void) {
+	Checkpoint_Queue(NULL, 0);
+}
+
+void Checkpoint_Task(void) {
+	if (m_pendingStep >= CHECKPOINT_STEP_IDLE || !eeprom_is_ready())
+		return;
+
+	// Unchanged bytes are skipped, they don't need to be programmed again
+	uint8_t* slot = (uint8_t*)&m_slots[m_pendingSlot];
+	if (m_pendingStep < CHECKPOINT_STEP_DATA)
+	{
+		eeprom_update_byte(slot + offsetof(Checkpoint_t, commit), CHECKPOINT_CLEARED);
+	}
+	else if (m_pendingStep < CHECKPOINT_STEP_COMMIT)
+	{
+		uint8_t index = m_pendingStep - CHECKPOINT_STEP_DATA;
+		eeprom_update_byte(slot + index, ((const uint8_t*)&m_pending)[index]);
+	}
+	else
+	{
+		eeprom_update_byte(slot + offsetof(Checkpoint_t, commit), m_pending.commit);
+	}
+	m_pendingStep++;
+}
@@ -0,0 +1,63 @@
+/*
+Progress checkpoints kept in EEPROM so that a bot which loses power (cable
+pulled, Switch docked/undocked, ...) resumes where it left off instead of
+starting over.
+
+A bot saves a small block of its own state at a loop boundary, and loads it
+back in SetupBot. Checkpoints are written to a ring of EEPROM slots, one slot
+per save, so the wear is spread over the whole ring and a save interrupted by
+a power loss never corrupts the previous checkpoint. The write itself is done
+one byte at a time from Checkpoint_Task in the main loop, so it never stalls for
+the ~3.4 ms an EEPROM byte takes to program.
+
+A bot checks its state fits with CHECKPOINT_ASSERT_SIZE next to each
+Checkpoint_Load and Checkpoint_Save. Both also refuse a larger state at run
+time and return false.
+
+Checkpoints are tied to the build they were saved by: flashing a new hex (new
+bot or new configuration) always starts fresh. To discard the checkpoint of the
+current build, hold CHECKPOINT_CLEAR_PIN to ground while plugging the board in,
+or build with the bot's m_resumeProgress set to false.
+*/
+
+#ifndef _CHECKPOINT_H_
+#define _CHECKPOINT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <avr/pgmspace.h>
+
+// Largest state a bot can save
+#define CHECKPOINT_MAX_SIZE 8
+
+// Number of EEPROM slots the checkpoints rotate through
+#define CHECKPOINT_SLOTS 28
+
+// Minimum time between two saves, in ms
+#define CHECKPOINT_INTERVAL_MS 10000
+
+// PB4 is on the 16u2's 4 pin header (JP2) of the UNO R3 and is pin 8 of the Micro/Leonardo.
+#define CHECKPOINT_CLEAR_DDR  DDRB
+#define CHECKPOINT_CLEAR_PORT PORTB
+#define CHECKPOINT_CLEAR_PIN  PINB
+#define CHECKPOINT_CLEAR_BIT  PB4
+
+// Fails the build if state (a variable or a type) doesn't fit in a checkpoint
+#define CHECKPOINT_ASSERT_SIZE(state) \
+	_Static_assert(sizeof(state) <= CHECKPOINT_MAX_SIZE, "checkpoint state is too large")
+
+// Load the latest checkpoint saved by this build into state, returns false if there is none.
+#define Checkpoint_Load(state, size) Checkpoint_LoadBuild(PSTR(__DATE__ " " __TIME__), state, size)
+bool Checkpoint_LoadBuild(const char* build, void* state, uint8_t size);
+
+// Save state, at most once every CHECKPOINT_INTERVAL_MS unless force is set.
+// Returns false if the state was not saved.
+bool Checkpoint_Save(const void* state, uint8_t size, bool force);
+
+// Discard the checkpoint, called once the bot is done.
+void Checkpoint_Clear(void);
+
+// Write the pending checkpoint to EEPROM, called from the main loop.
+void Checkpoint_Task(void);
+
+#endif
@@ -0,0 +1,115 @@
+/*
+The "sync and unsync the clock, then +1 year" routine shared by the bots that
+skip days through System Settings (AutoHost, AutoLoto, AutoRoller, BerryFarmer,
+WattFarmer and WattBerryFarmer).
+
+A bot puts DATETIME_COMMANDS(settingsMove, syncWait) in its m_command table,
+at the index it defines as DATETIME, and selects its parts like any of its own
+sequences:
+
+	commandIndex = DATETIME + DATETIME_SETTINGS;
+	m_endIndex = DATETIME + DATETIME_SYNC_END;
+
+The bots kept the System Settings navigation and sync wait they were tuned
+with: AutoHost and AutoRoller take one more step down to Date and Time and wait
+8 after the sync, the others pass NOTHING and 12:
+
+	DATETIME_COMMANDS(DOWN, 8),
+	DATETIME_COMMANDS(NOTHING, 12),
+
+The bots need their button mapping to handle HOME, NOTHING, A, DOWN, RDOWN,
+RIGHT, RRIGHT, RIGHT_A and UP_A.
+*/
+
+#ifndef _DATETIME_H_
+#define _DATETIME_H_
+
+// HOME to System Settings > Date and Time, cursor on "Synchronize Clock via Internet"
+#define DATETIME_SETTINGS      0
+#define DATETIME_SETTINGS_END  33
+// Turn the sync on and back off, resetting the date to today
+#define DATETIME_SYNC          34
+#define DATETIME_SYNC_END      37
+// Open the date picker
+#define DATETIME_PICKER        38
+#define DATETIME_PICKER_END    41
+// +1 year, cursor left on OK. The picker starts on the day (EU/US) or the year (JP).
+#define DATETIME_PLUS_YEAR(region) ((region) == 0 ? 44 : 42)
+#define DATETIME_PLUS_YEAR_END 47
+// Press OK
+#define DATETIME_CONFIRM       48
+#define DATETIME_CONFIRM_END   49
+// Back to the game
+#define DATETIME_BACK          50
+#define DATETIME_BACK_END      53
+
+#define DATETIME_COMMANDS(settingsMove, syncWait) \
+	/* To System Settings [0,11] */ \
+	{HOME, 1}, \
+	{NOTHING, 30}, \
+	{DOWN, 1}, \
+	{NOTHING, 1}, \
+	{RIGHT, 1}, \
+	{NOTHING, 1},		/* NSO home button added in ver 11.0 */ \
+	{RIGHT, 1}, \
+	{NOTHING, 1}, \
+	{RRIGHT, 1}, \
+	{RIGHT, 1}, \
+	{RRIGHT, 1}, \
+	{A, 40}, \
+	\
+	/* To Date and Time [12,33] */ \
+	{DOWN, 1}, \
+	{RDOWN, 1}, \
+	{DOWN, 1}, \
+	{RDOWN, 1}, \
+	{DOWN, 1}, \
+	{RDOWN, 1}, \
+	{DOWN, 1}, \
+	{RDOWN, 1}, \
+	{DOWN, 1}, \
+	{RDOWN, 1}, \
+	{DOWN, 1}, \
+	{RDOWN, 1}, \
+	{DOWN, 1}, \
+	{RDOWN, 1}, \
+	{A, 12}, \
+	{DOWN, 1}, \
+	{RDOWN, 1}, \
+	{DOWN, 1}, \
+	{RDOWN, 1}, \
+	{settingsMove, 1},	/* DOWN, or NOTHING to stay on the same entry */ \
+	{A, 1}, \
+	{NOTHING, 12}, \
+	\
+	/* Sync and unsync time [34,37] */ \
+	{A, 1}, \
+	{NOTHING, 4}, \
+	{A, 1}, \
+	{NOTHING, syncWait}, \
+	\
+	/* To actually Date and Time [38,41] */ \
+	{DOWN, 1}, \
+	{RDOWN, 1}, \
+	{A, 1}, \
+	{NOTHING, 7}, \
+	\
+	/* Plus 1 year [42,47] */ \
+	{RIGHT_A, 1},		/* EU/US start */ \
+	{NOTHING, 1}, \
+	{UP_A, 1},		/* JP start */ \
+	{RRIGHT, 1}, \
+	{RIGHT_A, 1}, \
+	{RRIGHT, 1}, \
+	\
+	/* Confirm [48,49] */ \
+	{A, 1}, \
+	{NOTHING, 4}, \
+	\
+	/* Back to game [50,53] */ \
+	{HOME, 1}, \
+	{NOTHING, 30}, \
+	{HOME, 1}, \
+	{NOTHING, 30}
+
+#endif
@@ -0,0 +1,30 @@
+/*
+Egg steps shared by the egg hatching bots.
+
+The bots are configured with the number of steps the species takes to hatch
+(see EggHatcher/EggCycles.txt, the hex service also looks them up by species)
+and whether the party Pokemon has Flame Body, Magma Armor or Steam Engine.
+Every species hatches in a multiple of 1280 steps, so the bots tune their
+bike loops per step group: group 0 is 1280 steps with one of those abilities,
+group 1 is 2560 steps, and so on. Without one, an egg needs twice the steps.
+*/
+
+#ifndef _EGGSTEPS_H_
+#define _EGGSTEPS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define EGG_STEPS_PER_GROUP 1280
+
+// Step group of an egg that takes steps to hatch, rounded up.
+static inline uint8_t EggSteps_Group(uint16_t steps, bool flameBody) {
+	uint8_t groups = (steps + EGG_STEPS_PER_GROUP - 1) / EGG_STEPS_PER_GROUP;
+	if (!flameBody)
+	{
+		groups *= 2;
+	}
+	return groups ? groups - 1 : 0;
+}
+
+#endif
@@ -0,0 +1,39 @@
+/*
+xorshift PRNG, see Random.h.
+
+16-bit xorshift with the (7, 9, 8) triplet, which has a period of 65535 over
+the non-zero states. The timer byte mixed in before each step can only move
+the state around that cycle, except onto 0, which is skipped.
+*/
+
+#include <avr/io.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+#include "Random.h"
+
+static uint16_t EEMEM m_bootCount;
+static uint16_t m_state;
+
+void Random_Init(uint16_t seed) {
+	uint16_t boots = eeprom_read_word(&m_bootCount) + 1;
+	eeprom_update_word(&m_bootCount, boots);
+
+	m_state = _crc16_update(_crc16_update(seed, boots & 0xFF), boots >> 8);
+
+	// Timer0 free-running at clk/1
+	TCCR0A = 0;
+	TCCR0B = (1 << CS00);
+}
+
+uint16_t Random_Next(void) {
+	uint16_t x = m_state ^ TCNT0;
+	if (x == 0)
+	{
+		x = 1;
+	}
+	x ^= x << 7;
+	x ^= x >> 9;
+	x ^= x << 8;
+	m_state = x;
+	return x;
+}
@@ -0,0 +1,29 @@
+/*
+Small PRNG shared by the bots, in place of avr-libc's rand() and its 32-bit
+arithmetic.
+
+The 16u2 has no ADC to sample noise from, so the generator is seeded in
+SetupBot from the bot's configured seed and a boot counter kept in EEPROM, and
+every draw also mixes in Timer0, which runs freely at clk/1. The host polls us
+on its own clock, so by the time the first report is taken the timer is
+effectively random. Two boards with the same configuration, or the same board
+after a reboot, draw different sequences.
+*/
+
+#ifndef _RANDOM_H_
+#define _RANDOM_H_
+
+#include <stdint.h>
+
+// Seed the generator, called once from SetupBot.
+void Random_Init(uint16_t seed);
+
+// Next 16-bit number.
+uint16_t Random_Next(void);
+
+// Number in [0, range).
+static inline uint16_t Random_Range(uint16_t range) {
+	return Random_Next() % range;
+}
+
+#endif
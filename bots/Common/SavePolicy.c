@@ -0,0 +1,39 @@
+/*
+When to save, see SavePolicy.h.
+*/
+
+#include "../Joystick.h"
+#include "SavePolicy.h"
+
+static uint32_t m_maxLossMS;
+static uint32_t m_lastMark;   // end of the last collection or save
+static uint32_t m_collectMS;  // time of the last collection
+static uint32_t m_saveMS;     // time of the last save, 0 until measured
+static uint16_t m_collected;  // collections since the last save
+
+void SavePolicy_Init(uint16_t maxLossMinutes) {
+	m_maxLossMS = (uint32_t)maxLossMinutes * 60000;
+	m_lastMark = GetUptimeMS();
+}
+
+bool SavePolicy_Collected(void) {
+	uint32_t now = GetUptimeMS();
+	m_collectMS = now - m_lastMark;
+	m_lastMark = now;
+	m_collected++;
+
+	// The collections we can lose on top of a save
+	uint32_t interval = 1;
+	if (m_collectMS && m_maxLossMS > m_saveMS + m_collectMS)
+	{
+		interval = (m_maxLossMS - m_saveMS) / m_collectMS;
+	}
+	return m_collected >= interval;
+}
+
+void SavePolicy_Saved(void) {
+	uint32_t now = GetUptimeMS();
+	m_saveMS = now - m_lastMark;
+	m_lastMark = now;
+	m_collected = 0;
+}
@@ -0,0 +1,34 @@
+/*
+When to save, for the farming bots that skip days in the Wild Area
+(BerryFarmer, WattFarmer and WattBerryFarmer).
+
+Skipping dates can crash the game, losing everything farmed since the last
+save. Saving often loses less, but every save is time not spent farming. So
+the bots are configured with the most farming time they can afford to lose,
+m_maxLossMinutes, and save as rarely as that allows. A crash during a save
+loses the collections since the previous one and the save itself, so with
+collections taking C and a save S, a bot saves every (loss - S) / C
+collections, and at least every collection.
+
+C and S are measured on the uptime clock as the bot runs, so they follow the
+timing profile the bot was built with. Until the first save is measured, S
+counts as 0 and the first interval is a save longer.
+*/
+
+#ifndef _SAVEPOLICY_H_
+#define _SAVEPOLICY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Set the farming time the bot can afford to lose, called once from SetupBot.
+void SavePolicy_Init(uint16_t maxLossMinutes);
+
+// A collection (date skip included) has just been completed. Returns true
+// when the bot should save now.
+bool SavePolicy_Collected(void);
+
+// The save the bot was told to make has just been completed.
+void SavePolicy_Saved(void);
+
+#endif
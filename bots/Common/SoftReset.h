@@ -0,0 +1,59 @@
+/*
+The soft reset shared by the bots that restart the game from the HOME menu
+(AutoFossil, AutoHost, AutoRoller and PurpleBeam): close the game, start it
+again and load back in.
+
+The game tile and the user picker are pressed through with A_SPAM: A every
+other pair of reports, so each takes it as soon as it accepts input. The
+title screen gets its own A_SPAM window after the game has had time to boot.
+It ends where the single A of the old sequence was pressed, and is shorter
+than the fastest load from the title screen into the game. So A is never
+pressed into the overworld, where the bots stand at a den or a wishing piece.
+The rest of the load is a plain wait. A_SPAM is scaled by the timing profile
+like the waits.
+
+A bot puts SOFTRESET_COMMANDS in its m_command table at the index it defines
+as SOFTRESET, right after its own HOME press, and runs it up to
+SOFTRESET + SOFTRESET_END. Bots with m_titleScreenBuffer add
+SOFTRESET_TITLE_BUFFER to the boot wait at SOFTRESET + SOFTRESET_BOOT.
+
+The bots need their button mapping to handle X, A, A_SPAM and NOTHING.
+*/
+
+#ifndef _SOFTRESET_H_
+#define _SOFTRESET_H_
+
+// Close the game, from the HOME menu
+#define SOFTRESET_CLOSE        0
+// Start it again, pressing A through the game tile and user picker
+#define SOFTRESET_START        4
+// Wait for the game to boot up to its title screen
+#define SOFTRESET_BOOT         5
+// Press A through the title screen
+#define SOFTRESET_TITLE        6
+// Load into the game
+#define SOFTRESET_END          7
+
+// Extra wait when the title screen takes long to show up
+#define SOFTRESET_TITLE_BUFFER 280
+
+#define SOFTRESET_COMMANDS \
+	/* Close the game [0,3] */ \
+	{X, 1}, \
+	{NOTHING, 8}, \
+	{A, 1},			/* Confirm close game */ \
+	{NOTHING, 20}, \
+	\
+	/* Choose game, pick user [4] */ \
+	{A_SPAM, 210}, \
+	\
+	/* Game boots up to the title screen [5] */ \
+	{NOTHING, 594}, \
+	\
+	/* Enter game [6] */ \
+	{A_SPAM, 150}, \
+	\
+	/* Load into the game [7] */ \
+	{NOTHING, 460}
+
+#endif
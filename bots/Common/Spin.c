@@ -0,0 +1,34 @@
+/*
+Analog spinning on the bike, see Spin.h.
+*/
+
+#include <avr/pgmspace.h>
+#include "../Joystick.h"
+#include "Spin.h"
+
+// Stick deflection for the first quarter turn, 127 * sin(angle) for 0 to 64
+static const uint8_t m_quarterSine[SPIN_TURN / 4 + 1] PROGMEM = {
+	0, 3, 6, 9, 12, 16, 19, 22, 25, 28, 31, 34, 37, 40, 43, 46,
+	49, 51, 54, 57, 60, 63, 65, 68, 71, 73, 76, 78, 81, 83, 85, 88,
+	90, 92, 94, 96, 98, 100, 102, 104, 106, 107, 109, 111, 112, 113, 115, 116,
+	117, 118, 120, 121, 122, 122, 123, 124, 125, 125, 126, 126, 126, 127, 127, 127,
+	127
+};
+
+// Stick position along an axis, from the center, for sin(angle).
+static int8_t Spin_Sine(uint8_t angle) {
+	uint8_t index = angle % (SPIN_TURN / 4);
+	if (angle & (SPIN_TURN / 4))
+	{
+		index = SPIN_TURN / 4 - index;
+	}
+
+	int8_t value = pgm_read_byte(&m_quarterSine[index]);
+	return (angle & (SPIN_TURN / 2)) ? -value : value;
+}
+
+void Spin_Stick(uint8_t angle, uint8_t* const x, uint8_t* const y) {
+	*x = STICK_CENTER + Spin_Sine(angle);
+	// Y grows downwards, and up is the cosine
+	*y = STICK_CENTER - Spin_Sine(angle + SPIN_TURN / 4);
+}
@@ -0,0 +1,27 @@
+/*
+Analog spinning on the bike, for the egg hatching bots (EggHatcher and
+InfiniteHatcher).
+
+Eggs hatch on steps, so the bots want to cover as much ground per second as
+they can without leaving the spot they spin on. Rather than D-pad squares,
+which slow the bike down at every corner, or holding up while the camera
+turns, the left stick is driven around a circle: the bike stays at full speed
+and rides a tight loop.
+
+Angles are in 1/SPIN_TURN of a turn, 0 is up and they go clockwise. A bot
+keeps the angle of its SPIN commands and moves it on by its angular speed on
+each report, like the other buttons its mapping handles.
+*/
+
+#ifndef _SPIN_H_
+#define _SPIN_H_
+
+#include <stdint.h>
+
+// A full turn
+#define SPIN_TURN 256
+
+// Puts the left stick (x, y of a report) on the circle at angle.
+void Spin_Stick(uint8_t angle, uint8_t* const x, uint8_t* const y);
+
+#endif
@@ -0,0 +1,115 @@
+/*
+Telemetry records, queued in a small ring buffer and sent by the USART
+data register empty interrupt so that the report loop never waits on the
+serial line. Records that don't fit are dropped and counted.
+*/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/crc16.h>
+#include <LUFA/Drivers/Peripheral/Serial.h>
+#include "../Joystick.h"
+
+// Must be a power of two
+#define TELEMETRY_BUFFER_SIZE 32
+
+static uint8_t m_buffer[TELEMETRY_BUFFER_SIZE];
+static volatile uint8_t m_head = 0; // next byte to write
+static volatile uint8_t m_tail = 0; // next byte to send
+
+static uint32_t m_loops = 0;
+static uint32_t m_lastStatus = 0;
+static uint8_t m_dropped = 0;
+
+// Record being assembled
+static uint8_t m_record[10];
+static uint8_t m_recordLength;
+
+void Telemetry_Init(void) {
+	UBRR1  = SERIAL_2X_UBBRVAL(TELEMETRY_BAUD);
+	UCSR1C = ((1 << UCSZ11) | (1 << UCSZ10));
+	UCSR1A = (1 << U2X1);
+	UCSR1B = (1 << TXEN1);
+}
+
+static void Record_Begin(uint8_t type) {
+	m_record[0] = type;
+	m_recordLength = 1;
+}
+
+static void Record_Add(uint32_t value, uint8_t bytes) {
+	while (bytes--)
+	{
+		m_record[m_recordLength++] = value & 0xFF;
+		value >>= 8;
+	}
+}
+
+// Queue the record as a whole, or drop it if the buffer can't take all of it.
+static void Record_Send(void) {
+	uint8_t used = (m_head - m_tail) & (TELEMETRY_BUFFER_SIZE - 1);
+	if (TELEMETRY_BUFFER_SIZE - 1 - used < m_recordLength + 2)
+	{
+		if (m_dropped < 0xFF)
+		{
+			m_dropped++;
+		}
+		return;
+	}
+
+	uint8_t head = m_head;
+	uint8_t crc = 0;
+	m_buffer[head] = TELEMETRY_SYNC;
+	head = (head + 1) & (TELEMETRY_BUFFER_SIZE - 1);
+	for (uint8_t i = 0; i < m_recordLength; i++)
+	{
+		crc = _crc8_ccitt_update(crc, m_record[i]);
+		m_buffer[head] = m_record[i];
+		head = (head + 1) & (TELEMETRY_BUFFER_SIZE - 1);
+	}
+	m_buffer[head] = crc;
+	m_head = (head + 1) & (TELEMETRY_BUFFER_SIZE - 1);
+
+	// Let the interrupt drain the buffer
+	UCSR1B |= (1 << UDRIE1);
+}
+
+void Telemetry_Task(void) {
+	uint32_t uptime = GetUptimeMS();
+	if (uptime - m_lastStatus < TELEMETRY_STATUS_MS)
+		return;
+
+	m_lastStatus = uptime;
+	Record_Begin(TLM_STATUS);
+	Record_Add(uptime, 4);
+	Record_Add(GetPollCadence(), 2);
+	Record_Add(m_dropped, 1);
+	Record_Send();
+}
+
+void Telemetry_Sequence(int start, int end) {
+	Record_Begin(TLM_SEQUENCE);
+	Record_Add(GetUptimeMS(), 4);
+	Record_Add(start, 2);
+	Record_Add(end, 2);
+	Record_Send();
+}
+
+void Telemetry_Loop(void) {
+	m_loops++;
+	Record_Begin(TLM_LOOP);
+	Record_Add(GetUptimeMS(), 4);
+	Record_Add(m_loops, 4);
+	Record_Send();
+}
+
+ISR(USART1_UDRE_vect) {
+	if (m_tail == m_head)
+	{
+		UCSR1B &= ~(1 << UDRIE1);
+		return;
+	}
+
+	UDR1 = m_buffer[m_tail];
+	m_tail = (m_tail + 1) & (TELEMETRY_BUFFER_SIZE - 1);
+}
@@ -0,0 +1,46 @@
+/*
+Optional telemetry over the USART that the atmega16u2 on an Arduino UNO R3
+shares with the 328P (pin 0 / RX on the header). Build with TELEMETRY=Y to
+enable it; otherwise every call below compiles to nothing.
+
+Each record is framed as:
+	0xA5, type, payload (little-endian), CRC-8/CCITT of type + payload
+Decode with tools/telemetry.js.
+*/
+
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+
+#include <stdint.h>
+
+#define TELEMETRY_SYNC     0xA5
+#define TELEMETRY_BAUD     115200
+#define TELEMETRY_STATUS_MS 1000
+
+// Record types
+typedef enum {
+	TLM_SEQUENCE = 0x01, // u32 uptime ms, u16 start command index, u16 end command index
+	TLM_LOOP     = 0x02, // u32 uptime ms, u32 loops completed
+	TLM_STATUS   = 0x03, // u32 uptime ms, u16 poll cadence (1/64 ms), u8 records dropped
+} TelemetryRecord_t;
+
+#ifdef TELEMETRY
+// Setup the USART, called from SetupHardware.
+void Telemetry_Init(void);
+
+// Send a status record every TELEMETRY_STATUS_MS, called from the main loop.
+void Telemetry_Task(void);
+
+// A new command sequence [start, end] has been selected.
+void Telemetry_Sequence(int start, int end);
+
+// One loop of the bot (raid, egg column, day skipped, ...) has been completed.
+void Telemetry_Loop(void);
+#else
+static inline void Telemetry_Init(void) {}
+static inline void Telemetry_Task(void) {}
+static inline void Telemetry_Sequence(int start, int end) {}
+static inline void Telemetry_Loop(void) {}
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+/*
+Console timing profiles
+
+The waits in the command tables were tuned on a stock V1 Switch. A build can
+stretch or shrink all of them with TIMING (a named profile) or TIME_SCALE (a
+percentage), see the makefile:
+
+	make TARGET=AutoHost TIMING=fast
+	make TARGET=AutoHost TIME_SCALE=90
+
+Only waits (NOTHING and A_SPAM commands) of at least TIMING_MIN_WAIT are
+scaled. The short gaps between menu inputs and the length of every press are
+left alone, the console reads those at the same speed whatever its load times
+are. Waits on the game's own clock (raid lobby, Surprise Trade search) use
+WAIT instead of NOTHING and are never scaled either, nor is B_SPAM, which
+skips through dialogue and fanfares that also run on the game's clock.
+
+Bots call Timing_Apply on each command they read from their table, before
+their own overrides so the durations set in Config.h are taken as is. With the
+default scale of 100 it compiles to nothing.
+*/
+
+#ifndef _TIMING_H_
+#define _TIMING_H_
+
+// Profiles, in percent of the stock timings
+#define TIMING_FAST  80  // OLED and V2 consoles, game on the system memory
+#define TIMING_STOCK 100 // V1 consoles
+#define TIMING_SLOW  130 // Slow SD cards, modded or overheating consoles
+
+#ifndef TIME_SCALE
+#define TIME_SCALE TIMING_STOCK
+#endif
+
+#if TIME_SCALE < 25 || TIME_SCALE > 400
+#error "TIME_SCALE must be between 25 and 400 (percent)"
+#endif
+
+// Shorter waits only space out menu inputs
+#define TIMING_MIN_WAIT 10
+
+// TIME_SCALE in 1/256, so scaling is a multiply and a shift
+#define TIMING_FACTOR (((uint32_t)TIME_SCALE * 256 + 50) / 100)
+
+// Scales the wait of a command just read from a table.
+static inline void Timing_Apply(Command* const command) {
+	if (TIME_SCALE != TIMING_STOCK && (command->button == NOTHING || command->button == A_SPAM) &&
+		command->duration >= TIMING_MIN_WAIT)
+	{
+		command->duration = ((uint32_t)command->duration * TIMING_FACTOR) >> 8;
+	}
+}
+
+#endif
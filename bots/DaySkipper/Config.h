@@ -1,8 +1,9 @@
 // WARNING: You are not adviced to change this manually
 // Please run AutoControllerHelper tool!!!
 
-uint8_t m_JP_EU_US = 1;
-uint8_t m_day = 13;
-uint8_t m_month = 6;
-int m_year = 2020;
-int m_dayToSkip = 984;
+static const uint8_t m_JP_EU_US = 1;
+static const uint8_t m_day = 13;
+static const uint8_t m_month = 6;
+static const int m_year = 2020;
+static const int m_dayToSkip = 984;
+static const bool m_resumeProgress = true;
@@ -19,119 +19,10 @@ these buttons for our use.
 */
 
 #include "../Joystick.h"
+#include "Calendar.h"
 #include "Commands.h"
 #include "Config.h"
 
-// Main entry point.
-int main(void) {
-	// We'll start by performing hardware and peripheral setup.
-	SetupHardware();
-	// We'll then enable global interrupts for our use.
-	GlobalInterruptEnable();
-	// Once that's done, we'll enter an infinite loop.
-	for (;;)
-	{
-		// We need to run our task to process and deliver data for our IN and OUT endpoints.
-		HID_Task();
-		// We also need to run the main USB management task.
-		USB_USBTask();
-	}
-}
-
-// Configures hardware and peripherals, such as the USB peripherals.
-void SetupHardware(void) {
-	// We need to disable watchdog if enabled by bootloader/fuses.
-	MCUSR &= ~(1 << WDRF);
-	wdt_disable();
-
-	// We need to disable clock division before initializing the USB hardware.
-	//clock_prescale_set(clock_div_1);
-	// We can then initialize our hardware and peripherals, including the USB stack.
-
-	#ifdef ALERT_WHEN_DONE
-	// Both PORTD and PORTB will be used for the optional LED flashing and buzzer.
-	#warning LED and Buzzer functionality enabled. All pins on both PORTB and \
-PORTD will toggle when printing is done.
-	DDRD  = 0xFF; //Teensy uses PORTD
-	PORTD =  0x0;
-                  //We'll just flash all pins on both ports since the UNO R3
-	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
-	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
-	#endif
-	// The USB stack should be initialized last.
-	USB_Init();
-}
-
-// Fired to indicate that the device is enumerating.
-void EVENT_USB_Device_Connect(void) {
-	// We can indicate that we're enumerating here (via status LEDs, sound, etc.).
-}
-
-// Fired to indicate that the device is no longer connected to a host.
-void EVENT_USB_Device_Disconnect(void) {
-	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
-}
-
-// Fired when the host set the current configuration of the USB device after enumeration.
-void EVENT_USB_Device_ConfigurationChanged(void) {
-	bool ConfigSuccess = true;
-
-	// We setup the HID report endpoints.
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-
-	// We can read ConfigSuccess to indicate a success or failure at this point.
-}
-
-// Process control requests sent to the device from the USB host.
-void EVENT_USB_Device_ControlRequest(void) {
-	// We can handle two control requests: a GetReport and a SetReport.
-
-	// Not used here, it looks like we don't receive control request from the Switch.
-}
-
-// Process and deliver data from IN and OUT endpoints.
-void HID_Task(void) {
-	// If the device isn't connected and properly configured, we can't do anything here.
-	if (USB_DeviceState != DEVICE_STATE_Configured)
-		return;
-
-	// We'll start with the OUT endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
-	// We'll check to see if we received something on the OUT endpoint.
-	if (Endpoint_IsOUTReceived())
-	{
-		// If we did, and the packet has data, we'll react to it.
-		if (Endpoint_IsReadWriteAllowed())
-		{
-			// We'll create a place to store our data received from the host.
-			USB_JoystickReport_Output_t JoystickOutputData;
-			// We'll then take in that data, setting it up in our storage.
-			while(Endpoint_Read_Stream_LE(&JoystickOutputData, sizeof(JoystickOutputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-			// At this point, we can react to this data.
-
-			// However, since we're not doing anything with this data, we abandon it.
-		}
-		// Regardless of whether we reacted to the data, we acknowledge an OUT packet on this endpoint.
-		Endpoint_ClearOUT();
-	}
-
-	// We'll then move on to the IN endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
-	// We first check to see if the host is ready to accept data.
-	if (Endpoint_IsINReady())
-	{
-		// We'll create an empty report.
-		USB_JoystickReport_Input_t JoystickInputData;
-		// We'll then populate this report with what we want to send to the host.
-		GetNextReport(&JoystickInputData);
-		// Once populated, we can output this data to the host. We do this by first writing the data to the control stream.
-		while(Endpoint_Write_Stream_LE(&JoystickInputData, sizeof(JoystickInputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-		// We then send an IN packet on this endpoint.
-		Endpoint_ClearIN();
-	}
-}
-
 typedef enum {
 	PROCESS,
 	DONE
@@ -149,6 +40,50 @@ int durationCount = 0;
 int commandIndex = 0;
 int m_endIndex = 8;
 
+// Date shown on the Switch, starts at the configured date
+Date_t m_date;
+int m_skipped = 0;
+
+// Skip sequence {start, end} of each rollover, for JP, EU and US
+static const uint8_t m_skipSequences[ROLLOVER_COUNT][3][2] PROGMEM = {
+	{{13, 21}, {49, 61}, {49, 61}},		// Day (EU/US is the same)
+	{{22, 33}, {62, 75}, {91, 106}},	// Month
+	{{34, 48}, {76, 90}, {107, 122}},	// Year
+};
+
+// Progress kept in an EEPROM checkpoint, fixed width so it is the same on the board and in the sim
+typedef struct {
+	uint16_t skipped;
+	uint16_t date;	// Day in bits 0-4, month in bits 5-8, year from 2000 in bits 9-15
+} Progress_t;
+
+#define DATE_BASE_YEAR 2000
+
+static uint16_t PackDate(const Date_t* date) {
+	return date->day | (uint16_t)date->month << 5 | (uint16_t)(date->year - DATE_BASE_YEAR) << 9;
+}
+
+static void UnpackDate(uint16_t packed, Date_t* date) {
+	date->day = packed & 0x1F;
+	date->month = (packed >> 5) & 0x0F;
+	date->year = DATE_BASE_YEAR + (packed >> 9);
+}
+
+// Load the start date from the configuration, or resume an interrupted run.
+void SetupBot(void) {
+	m_date.day = m_day;
+	m_date.month = m_month;
+	m_date.year = m_year;
+
+	Progress_t progress;
+	CHECKPOINT_ASSERT_SIZE(progress);
+	if (m_resumeProgress && Checkpoint_Load(&progress, sizeof(Progress_t)))
+	{
+		m_skipped = progress.skipped;
+		UnpackDate(progress.date, &m_date);
+	}
+}
+
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 
@@ -180,119 +115,43 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
           state = DONE;
           break;
         }
-				else if (m_dayToSkip > 0)
+				else if (m_skipped < m_dayToSkip)
 				{
-					// Day = 0, Month = 1, Year = 2
-					uint8_t passDayMonthYear = 0;
-
-					if (m_month == 2)
-					{
-						bool isLeapYear = (m_year % 4 == 0);
-						if (isLeapYear && m_day == 29)
-						{
-							passDayMonthYear = 1;
-						}
-						else if (!isLeapYear && m_day == 28)
-						{
-							passDayMonthYear = 1;
-						}
-					}
-					else if (m_month == 12 && m_day == 31)
+					if (m_resumeProgress)
 					{
-						passDayMonthYear = 2;
-					}
-					else if (m_month == 4 || m_month == 6 || m_month == 9 || m_month == 11)
-					{
-						if (m_day == 30)
-						{
-							passDayMonthYear = 1;
-						}
-					}
-					else //if (m_month == 1 || m_month == 3 || m_month == 5 || m_month == 7 || m_month == 8 || m_month == 10)
-					{
-						if (m_day == 31)
-						{
-							passDayMonthYear = 1;
-						}
+						// Every day so far has been skipped on the Switch. Saved at every
+						// skip, an older date would make a resumed run skip too far.
+						Progress_t progress = {m_skipped, PackDate(&m_date)};
+						CHECKPOINT_ASSERT_SIZE(progress);
+						Checkpoint_Save(&progress, sizeof(Progress_t), true);
 					}
 
-					if (passDayMonthYear == 0)
-					{
-						// Pass day
-						m_day++;
-						if (m_JP_EU_US == 0)
-						{
-							commandIndex = 13;
-							m_endIndex = 21;
-						}
-						else
-						{
-							// EU/US is the same
-							commandIndex = 49;
-							m_endIndex = 61;
-						}
-					}
-					else if (passDayMonthYear == 1)
-					{
-						// Pass month
-						m_day = 1;
-						m_month++;
-						if (m_JP_EU_US == 0)
-						{
-							commandIndex = 22;
-							m_endIndex = 33;
-						}
-						else if (m_JP_EU_US == 1)
-						{
-							commandIndex = 62;
-							m_endIndex = 75;
-						}
-						else // if (m_JP_EU_US == 2)
-						{
-							commandIndex = 91;
-							m_endIndex = 106;
-						}
-					}
-					else
-					{
-						// Pass year
-						m_day = 1;
-						m_month = 1;
-						m_year++;
-						if (m_JP_EU_US == 0)
-						{
-							commandIndex = 34;
-							m_endIndex = 48;
-						}
-						else if (m_JP_EU_US == 1)
-						{
-							commandIndex = 76;
-							m_endIndex = 90;
-						}
-						else // if (m_JP_EU_US == 2)
-						{
-							commandIndex = 107;
-							m_endIndex = 122;
-						}
-					}
+					m_skipped++;
+					Telemetry_Loop();
+
+					// Skip the day, month or year depending on which one rolls over
+					Rollover_t rollover = Calendar_NextDay(&m_date);
+					commandIndex = pgm_read_byte(&m_skipSequences[rollover][m_JP_EU_US][0]);
+					m_endIndex = pgm_read_byte(&m_skipSequences[rollover][m_JP_EU_US][1]);
 				}
-				else if (m_dayToSkip == 0)
+				else
 				{
+					if (m_resumeProgress)
+					{
+						Checkpoint_Clear();
+					}
+
 					// Go back to game
 					commandIndex = 9;
 					m_endIndex = 12;
 				}
-				else // if (m_dayToSkip == -1)
-				{
-					// Finish
-					state = DONE;
-					break;
-				}
 
-				m_dayToSkip--;
+				// Report the newly selected sequence
+				Telemetry_Sequence(commandIndex, m_endIndex);
 			}
 
 			memcpy_P(&tempCommand, &(m_command[commandIndex]), sizeof(Command));
+			Timing_Apply(&tempCommand);
 			switch (tempCommand.button)
 			{
 				case UP:
@@ -29,7 +29,7 @@ static const Command m_command[] PROGMEM = {
 	{LEFT, 4},
 
 	// Increment day
-	{UP, 4},
+	{UP_A, 4},
 
 	// Move to OK
 	{RIGHT, 4},
@@ -51,7 +51,7 @@ static const Command m_command[] PROGMEM = {
 	{LEFT, 4},
 
 	// Increment day
-	{UP, 4},
+	{UP_A, 4},
 
 	// Move to OK
 	{RIGHT, 4},
@@ -67,4 +67,122 @@ static const Command m_command[] PROGMEM = {
 	{HOME, 4},
 	{NOTHING, 150},
 	{HOME, 4},
+
+	//----------Skip month JP [35,46]----------
+	{A, 5},
+	{NOTHING, 16},
+
+	// <<<^<^>>>>
+	{LEFT, 4},
+	{RLEFT, 4},
+	{LEFT, 4},
+	{UP, 4},
+	{RLEFT, 4},
+	{UP_A, 4},
+	{RIGHT, 4},
+	{RRIGHT, 4},
+
+	{RIGHT_A, 5},
+	{NOTHING, 16},
+
+	//----------Skip year JP [47,61]----------
+	{A, 5},
+	{NOTHING, 16},
+
+	// <<<^<^<^>>>>>
+	{LEFT, 4},
+	{RLEFT, 4},
+	{LEFT, 4},
+	{UP, 4},
+	{RLEFT, 4},
+	{UP, 4},
+	{LEFT, 4},
+	{UP_A, 4},
+	{RRIGHT, 4},
+	{RIGHT, 4},
+	{RRIGHT, 4},
+
+	{RIGHT_A, 5},
+	{NOTHING, 16},
+
+	//----------Skip month EU [62,75]----------
+	{A, 5},
+	{NOTHING, 16},
+
+	// <<<<<^>^>>>>
+	{LEFT, 4},
+	{RLEFT, 4},
+	{LEFT, 4},
+	{RLEFT, 4},
+	{LEFT, 4},
+	{UP_A, 4},
+	{NOTHING, 2},
+	{UP_A, 4},
+	{RIGHT, 4},
+	{RRIGHT, 4},
+
+	{RIGHT_A, 5},
+	{NOTHING, 16},
+
+	//----------Skip year EU [76,90]----------
+	{A, 5},
+	{NOTHING, 16},
+
+	// <<<<<^>^>^>>>
+	{LEFT, 4},
+	{RLEFT, 4},
+	{LEFT, 4},
+	{RLEFT, 4},
+	{LEFT, 4},
+	{UP_A, 4},
+	{NOTHING, 2},
+	{UP_A, 4},
+	{NOTHING, 2},
+	{UP_A, 4},
+	{RRIGHT, 4},
+
+	{RIGHT_A, 5},
+	{NOTHING, 16},
+
+	//----------Skip month US [91,106]----------
+	{A, 5},
+	{NOTHING, 16},
+
+	// <<<<<^<^>>>>>>
+	{LEFT, 4},
+	{RLEFT, 4},
+	{LEFT, 4},
+	{RLEFT, 4},
+	{LEFT, 4},
+	{UP, 4},
+	{RLEFT, 4},
+	{UP_A, 4},
+	{RIGHT, 4},
+	{RRIGHT, 4},
+	{RIGHT, 4},
+	{RRIGHT, 4},
+
+	{RIGHT_A, 5},
+	{NOTHING, 16},
+
+	//----------Skip year US [107,122]----------
+	{A, 5},
+	{NOTHING, 16},
+
+	// <<<<<^<^>>^>>>>
+	{LEFT, 4},
+	{RLEFT, 4},
+	{LEFT, 4},
+	{RLEFT, 4},
+	{LEFT, 4},
+	{UP, 4},
+	{RLEFT, 4},
+	{UP_A, 4},
+	{RRIGHT, 4},
+	{UP_A, 4},
+	{RIGHT, 4},
+	{RRIGHT, 4},
+
+	{RIGHT_A, 5},
+	{NOTHING, 16}
 };
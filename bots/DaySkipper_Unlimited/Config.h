@@ -1,2 +1,5 @@
-uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
-unsigned long m_dayToSkip = 35; // Number of days to skip
+static const uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
+static const uint8_t m_day = 1; // Current date on the Switch
+static const uint8_t m_month = 1;
+static const int m_year = 2020;
+static const unsigned long m_dayToSkip = 35; // Number of days to skip
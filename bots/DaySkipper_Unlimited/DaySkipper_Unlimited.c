@@ -19,119 +19,10 @@ these buttons for our use.
 */
 
 #include "../Joystick.h"
+#include "Calendar.h"
 #include "Commands.h"
 #include "Config.h"
 
-// Main entry point.
-int main(void) {
-	// We'll start by performing hardware and peripheral setup.
-	SetupHardware();
-	// We'll then enable global interrupts for our use.
-	GlobalInterruptEnable();
-	// Once that's done, we'll enter an infinite loop.
-	for (;;)
-	{
-		// We need to run our task to process and deliver data for our IN and OUT endpoints.
-		HID_Task();
-		// We also need to run the main USB management task.
-		USB_USBTask();
-	}
-}
-
-// Configures hardware and peripherals, such as the USB peripherals.
-void SetupHardware(void) {
-	// We need to disable watchdog if enabled by bootloader/fuses.
-	MCUSR &= ~(1 << WDRF);
-	wdt_disable();
-
-	// We need to disable clock division before initializing the USB hardware.
-	//clock_prescale_set(clock_div_1);
-	// We can then initialize our hardware and peripherals, including the USB stack.
-
-	#ifdef ALERT_WHEN_DONE
-	// Both PORTD and PORTB will be used for the optional LED flashing and buzzer.
-	#warning LED and Buzzer functionality enabled. All pins on both PORTB and \
-PORTD will toggle when printing is done.
-	DDRD  = 0xFF; //Teensy uses PORTD
-	PORTD =  0x0;
-                  //We'll just flash all pins on both ports since the UNO R3
-	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
-	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
-	#endif
-	// The USB stack should be initialized last.
-	USB_Init();
-}
-
-// Fired to indicate that the device is enumerating.
-void EVENT_USB_Device_Connect(void) {
-	// We can indicate that we're enumerating here (via status LEDs, sound, etc.).
-}
-
-// Fired to indicate that the device is no longer connected to a host.
-void EVENT_USB_Device_Disconnect(void) {
-	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
-}
-
-// Fired when the host set the current configuration of the USB device after enumeration.
-void EVENT_USB_Device_ConfigurationChanged(void) {
-	bool ConfigSuccess = true;
-
-	// We setup the HID report endpoints.
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-
-	// We can read ConfigSuccess to indicate a success or failure at this point.
-}
-
-// Process control requests sent to the device from the USB host.
-void EVENT_USB_Device_ControlRequest(void) {
-	// We can handle two control requests: a GetReport and a SetReport.
-
-	// Not used here, it looks like we don't receive control request from the Switch.
-}
-
-// Process and deliver data from IN and OUT endpoints.
-void HID_Task(void) {
-	// If the device isn't connected and properly configured, we can't do anything here.
-	if (USB_DeviceState != DEVICE_STATE_Configured)
-		return;
-
-	// We'll start with the OUT endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
-	// We'll check to see if we received something on the OUT endpoint.
-	if (Endpoint_IsOUTReceived())
-	{
-		// If we did, and the packet has data, we'll react to it.
-		if (Endpoint_IsReadWriteAllowed())
-		{
-			// We'll create a place to store our data received from the host.
-			USB_JoystickReport_Output_t JoystickOutputData;
-			// We'll then take in that data, setting it up in our storage.
-			while(Endpoint_Read_Stream_LE(&JoystickOutputData, sizeof(JoystickOutputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-			// At this point, we can react to this data.
-
-			// However, since we're not doing anything with this data, we abandon it.
-		}
-		// Regardless of whether we reacted to the data, we acknowledge an OUT packet on this endpoint.
-		Endpoint_ClearOUT();
-	}
-
-	// We'll then move on to the IN endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
-	// We first check to see if the host is ready to accept data.
-	if (Endpoint_IsINReady())
-	{
-		// We'll create an empty report.
-		USB_JoystickReport_Input_t JoystickInputData;
-		// We'll then populate this report with what we want to send to the host.
-		GetNextReport(&JoystickInputData);
-		// Once populated, we can output this data to the host. We do this by first writing the data to the control stream.
-		while(Endpoint_Write_Stream_LE(&JoystickInputData, sizeof(JoystickInputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-		// We then send an IN packet on this endpoint.
-		Endpoint_ClearIN();
-	}
-}
-
 typedef enum {
 	PROCESS,
 	DONE
@@ -148,7 +39,51 @@ int durationCount = 0;
 // start and end index of "Setup"
 int commandIndex = 0;
 int m_endIndex = 8;
-int m_day = 1; // [1,31]
+// Date shown on the Switch, starts at the configured date
+Date_t m_date;
+unsigned long m_skipped = 0;
+
+// The Switch's dates end on December 31st, 2060
+#define LAST_YEAR 2060
+
+// Skip sequence {start, end} of each rollover, for JP, EU and US
+static const uint8_t m_skipSequences[ROLLOVER_COUNT][3][2] PROGMEM = {
+	{{9, 17}, {18, 30}, {18, 30}},		// Day (EU/US is the same)
+	{{35, 46}, {62, 75}, {91, 106}},	// Month
+	{{47, 61}, {76, 90}, {107, 122}},	// Year
+};
+
+// Whether, at the end of a month, it's quicker to let the day roll back to 1
+// and skip again from there than to roll the month or year over
+bool m_wrapDay[ROLLOVER_COUNT];
+
+// Number of reports sequence [start, end] takes, with the waits scaled
+static uint16_t SequenceReports(uint8_t start, uint8_t end) {
+	uint16_t reports = 0;
+	Command command;
+	for (uint8_t i = start; i <= end; i++)
+	{
+		memcpy_P(&command, &m_command[i], sizeof(Command));
+		Timing_Apply(&command);
+		reports += command.duration + 1;
+	}
+	return reports;
+}
+
+// Start from the configured date and pick the cheapest way past the end of a month.
+void SetupBot(void) {
+	m_date.day = m_day;
+	m_date.month = m_month;
+	m_date.year = m_year;
+
+	const uint8_t* day = m_skipSequences[ROLLOVER_DAY][m_JP_EU_US];
+	uint16_t wrapReports = 2 * SequenceReports(pgm_read_byte(&day[0]), pgm_read_byte(&day[1]));
+	for (uint8_t rollover = ROLLOVER_MONTH; rollover < ROLLOVER_COUNT; rollover++)
+	{
+		const uint8_t* sequence = m_skipSequences[rollover][m_JP_EU_US];
+		m_wrapDay[rollover] = wrapReports < SequenceReports(pgm_read_byte(&sequence[0]), pgm_read_byte(&sequence[1]));
+	}
+}
 
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
@@ -182,44 +117,60 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					state = DONE;
 					break;
 				}
-				else if (m_dayToSkip > 0)
+				else if (m_skipped < m_dayToSkip)
 				{
-					// Pass day
-					if (m_JP_EU_US == 0)
+					// Pick the day, month or year rollover that moves the date forward
+					Date_t next = m_date;
+					Rollover_t rollover = Calendar_NextDay(&next);
+					bool skipped = true;
+
+					if (rollover == ROLLOVER_YEAR && next.year > LAST_YEAR)
 					{
-						commandIndex = 9;
-						m_endIndex = 17;
+						// The year can't go any higher, rolling the month over goes back to January
+						rollover = ROLLOVER_MONTH;
+						next.year = LAST_YEAR;
+						skipped = false;
 					}
-					else
+					else if (rollover != ROLLOVER_DAY && m_wrapDay[rollover])
 					{
-						commandIndex = 18;
-						m_endIndex = 30;
+						// Rolling back to the 1st of the same month, no day skipped
+						rollover = ROLLOVER_DAY;
+						next = m_date;
+						next.day = 1;
+						skipped = false;
 					}
 
-					if (m_day == 31)
-					{
-						// Rolling back, no day skipped
-						m_day = 1;
-					}
-					else
+					commandIndex = pgm_read_byte(&m_skipSequences[rollover][m_JP_EU_US][0]);
+					m_endIndex = pgm_read_byte(&m_skipSequences[rollover][m_JP_EU_US][1]);
+					m_date = next;
+
+					if (skipped)
 					{
 						// Roll foward by a day
-						m_day++;
-						m_dayToSkip--;
+						m_skipped++;
+						Telemetry_Loop();
 					}
 				}
-				else //if (m_dayToSkip == 0)
+				else //if (m_skipped == m_dayToSkip)
 				{
 					// Go back to game
 					commandIndex = 31;
 					m_endIndex = 34;
 				}
+
+				// Report the newly selected sequence
+				Telemetry_Sequence(commandIndex, m_endIndex);
 			}
 
 			memcpy_P(&tempCommand, &(m_command[commandIndex]), sizeof(Command));
+			Timing_Apply(&tempCommand);
 			switch (tempCommand.button)
 			{
 				case UP:
+					ReportData->LY = STICK_MIN;
+					break;
+
+				case UP_A:
 					ReportData->LY = STICK_MIN;
 					ReportData->Button |= SWITCH_A;
 					break;
@@ -228,6 +179,19 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					ReportData->LX = STICK_MIN;
 					break;
 
+				case RLEFT:
+					ReportData->RX = STICK_MIN;
+					break;
+
+				case RRIGHT:
+					ReportData->RX = STICK_MAX;
+					break;
+
+				case RIGHT_A:
+					ReportData->LX = STICK_MAX;
+					ReportData->Button |= SWITCH_A;
+					break;
+
 				case DOWN:
 					ReportData->LY = STICK_MAX;
 					break;
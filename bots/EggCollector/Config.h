@@ -1 +1 @@
-int m_maxCycle = 70; // Number of attempts to collect an egg
+static const int m_maxCycle = 70; // Number of attempts to collect an egg
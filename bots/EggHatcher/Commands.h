@@ -80,7 +80,7 @@ static const Command m_command[] PROGMEM = {
 	{UP, 8},
 	{CAPTURE, 178},
 
-	//----------Small Cycles [59,63]----------
+	//----------Small Cycles [59,64]----------
 	{LEFT, 35},		// Set up before last cycle loop
 
 	{UP, 12},		// Small loops
@@ -88,12 +88,14 @@ static const Command m_command[] PROGMEM = {
 	{DOWN, 12},
 	{LEFT, 12},
 
-	//----------Hatching Eggs x5 [64,66]----------
+	{SPIN, 51},		// Small loop with m_spinSpeed, a turn starting up, as long as the four above
+
+	//----------Hatching Eggs x5 [65,67]----------
 	{LEFT, 28},
 	{B, 790},		// Wait long in case it was a shiny
 	{A, 110},
 
-	//----------Movement Fix After Hatch [67,68]----------
+	//----------Movement Fix After Hatch [68,69]----------
 	{DOWN, 40},
 	{CAPTURE, 90},
 };
@@ -1,2 +1,5 @@
-uint8_t m_eggStepGroup = 3;
-uint8_t m_columnsOfEggs = 24;
+static const uint16_t m_eggSteps = 5120; // Steps the species takes to hatch, see EggCycles.txt
+static const bool m_flameBody = true; // The party Pokemon has Flame Body, Magma Armor or Steam Engine
+static const uint8_t m_columnsOfEggs = 24;
+static const uint8_t m_spinSpeed = 0; // 1/256 of a turn per input for stick circle small loops, 0 for the D-pad square
+static const bool m_resumeProgress = true;
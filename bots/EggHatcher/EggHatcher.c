@@ -19,119 +19,11 @@ these buttons for our use.
 */
 
 #include "../Joystick.h"
+#include "EggSteps.h"
+#include "Spin.h"
 #include "Commands.h"
 #include "Config.h"
 
-// Main entry point.
-int main(void) {
-	// We'll start by performing hardware and peripheral setup.
-	SetupHardware();
-	// We'll then enable global interrupts for our use.
-	GlobalInterruptEnable();
-	// Once that's done, we'll enter an infinite loop.
-	for (;;)
-	{
-		// We need to run our task to process and deliver data for our IN and OUT endpoints.
-		HID_Task();
-		// We also need to run the main USB management task.
-		USB_USBTask();
-	}
-}
-
-// Configures hardware and peripherals, such as the USB peripherals.
-void SetupHardware(void) {
-	// We need to disable watchdog if enabled by bootloader/fuses.
-	MCUSR &= ~(1 << WDRF);
-	wdt_disable();
-
-	// We need to disable clock division before initializing the USB hardware.
-	//clock_prescale_set(clock_div_1);
-	// We can then initialize our hardware and peripherals, including the USB stack.
-
-	#ifdef ALERT_WHEN_DONE
-	// Both PORTD and PORTB will be used for the optional LED flashing and buzzer.
-	#warning LED and Buzzer functionality enabled. All pins on both PORTB and \
-PORTD will toggle when printing is done.
-	DDRD  = 0xFF; //Teensy uses PORTD
-	PORTD =  0x0;
-                  //We'll just flash all pins on both ports since the UNO R3
-	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
-	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
-	#endif
-	// The USB stack should be initialized last.
-	USB_Init();
-}
-
-// Fired to indicate that the device is enumerating.
-void EVENT_USB_Device_Connect(void) {
-	// We can indicate that we're enumerating here (via status LEDs, sound, etc.).
-}
-
-// Fired to indicate that the device is no longer connected to a host.
-void EVENT_USB_Device_Disconnect(void) {
-	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
-}
-
-// Fired when the host set the current configuration of the USB device after enumeration.
-void EVENT_USB_Device_ConfigurationChanged(void) {
-	bool ConfigSuccess = true;
-
-	// We setup the HID report endpoints.
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-
-	// We can read ConfigSuccess to indicate a success or failure at this point.
-}
-
-// Process control requests sent to the device from the USB host.
-void EVENT_USB_Device_ControlRequest(void) {
-	// We can handle two control requests: a GetReport and a SetReport.
-
-	// Not used here, it looks like we don't receive control request from the Switch.
-}
-
-// Process and deliver data from IN and OUT endpoints.
-void HID_Task(void) {
-	// If the device isn't connected and properly configured, we can't do anything here.
-	if (USB_DeviceState != DEVICE_STATE_Configured)
-		return;
-
-	// We'll start with the OUT endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
-	// We'll check to see if we received something on the OUT endpoint.
-	if (Endpoint_IsOUTReceived())
-	{
-		// If we did, and the packet has data, we'll react to it.
-		if (Endpoint_IsReadWriteAllowed())
-		{
-			// We'll create a place to store our data received from the host.
-			USB_JoystickReport_Output_t JoystickOutputData;
-			// We'll then take in that data, setting it up in our storage.
-			while(Endpoint_Read_Stream_LE(&JoystickOutputData, sizeof(JoystickOutputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-			// At this point, we can react to this data.
-
-			// However, since we're not doing anything with this data, we abandon it.
-		}
-		// Regardless of whether we reacted to the data, we acknowledge an OUT packet on this endpoint.
-		Endpoint_ClearOUT();
-	}
-
-	// We'll then move on to the IN endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
-	// We first check to see if the host is ready to accept data.
-	if (Endpoint_IsINReady())
-	{
-		// We'll create an empty report.
-		USB_JoystickReport_Input_t JoystickInputData;
-		// We'll then populate this report with what we want to send to the host.
-		GetNextReport(&JoystickInputData);
-		// Once populated, we can output this data to the host. We do this by first writing the data to the control stream.
-		while(Endpoint_Write_Stream_LE(&JoystickInputData, sizeof(JoystickInputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-		// We then send an IN packet on this endpoint.
-		Endpoint_ClearIN();
-	}
-}
-
 typedef enum {
 	PROCESS,
 	DONE
@@ -153,8 +45,40 @@ uint8_t m_sequence = 0;
 // currently hatching column (1-6,7-12,etc.)
 uint8_t m_column = 1;
 
-// Small loops for each egg group without losing turbo boost
-uint8_t m_smallCycle[] = {8,6,9,8,10,8,11,9};
+// Small loops for each egg step group without losing turbo boost
+static const uint8_t m_smallCycle[] PROGMEM = {8,6,9,8,10,8,11,9};
+#define SMALL_CYCLE_GROUPS (sizeof(m_smallCycle) / sizeof(m_smallCycle[0]))
+
+// Turbo and small loops that hatch the eggs
+uint8_t m_turboCycles;
+uint8_t m_smallCycles;
+
+// Where the stick is on its circle, for small loops with m_spinSpeed
+uint8_t m_spinAngle;
+
+// Resume from the column that was being hatched when the bot was interrupted,
+// and work out the loops needed for the eggs' steps.
+void SetupBot(void) {
+	if (m_resumeProgress)
+	{
+		CHECKPOINT_ASSERT_SIZE(m_column);
+		Checkpoint_Load(&m_column, sizeof(m_column));
+	}
+
+	uint8_t group = EggSteps_Group(m_eggSteps, m_flameBody);
+	m_turboCycles = group * 2 + 1;
+	if (group < SMALL_CYCLE_GROUPS)
+	{
+		m_smallCycles = pgm_read_byte(&m_smallCycle[group]);
+	}
+	else
+	{
+		// Past the tuned groups, both the odd and even groups need one more
+		// small loop every other group
+		uint8_t last = SMALL_CYCLE_GROUPS - 2 + (group & 1);
+		m_smallCycles = pgm_read_byte(&m_smallCycle[last]) + (group - last) / 2;
+	}
+}
 
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
@@ -192,6 +116,11 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 				}
 				else if (m_column > m_columnsOfEggs)
 				{
+					if (m_resumeProgress)
+					{
+						Checkpoint_Clear();
+					}
+
 					// Done press HOME
 					commandIndex = 4;
 					m_endIndex = 5;
@@ -200,47 +129,43 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 
 				if (m_sequence == 1)
 				{
+					if (m_resumeProgress)
+					{
+						// Every column before this one has been hatched
+						CHECKPOINT_ASSERT_SIZE(m_column);
+						Checkpoint_Save(&m_column, sizeof(m_column), false);
+					}
+
 					// Pick up eggs from Box
 					commandIndex = 16 - ((m_column - 1) % 6) * 2;
 					m_endIndex = 28;
 				}
-				else if (m_sequence <= 16)
+				else if (m_sequence <= 1 + m_turboCycles)
 				{
-					// turbo cycle count = m_eggStepGroup * 2 + 1
-					if (m_sequence == 2)
-					{
-						m_sequence += (14 - m_eggStepGroup * 2);
-					}
-
-					// Loop turbo cycle
+					// Loop turbo cycle, setting up the small loops after the last one
 					commandIndex = 53;
-					m_endIndex = (m_sequence == 16) ? 59 : 58;
+					m_endIndex = (m_sequence == 1 + m_turboCycles) ? 59 : 58;
 				}
-				else if (m_sequence <= 30) // Max 14 small cycles
+				else if (m_sequence <= 1 + m_turboCycles + m_smallCycles)
 				{
-					// Skip to amount of small cycles needed
-					if (m_sequence == 17)
-					{
-						m_sequence += (14 - m_smallCycle[m_eggStepGroup]);
-					}
-
-					// Do small loops at least 12 times
-					commandIndex = 60;
-					m_endIndex = 63;
+					// Small loops, the D-pad square or a stick circle of the same length
+					commandIndex = m_spinSpeed ? 64 : 60;
+					m_endIndex = m_spinSpeed ? 64 : 63;
+					m_spinAngle = 0;
 				}
-				else if (m_sequence <= 35)
+				else if (m_sequence <= 6 + m_turboCycles + m_smallCycles)
 				{
 					// Hatch 5 eggs
-					commandIndex = 64;
-					m_endIndex = 66;
+					commandIndex = 65;
+					m_endIndex = 67;
 				}
-				else if (m_sequence == 36)
+				else if (m_sequence == 7 + m_turboCycles + m_smallCycles)
 				{
 					// Go back to next to NPC
-					commandIndex = 67;
-					m_endIndex = 68;
+					commandIndex = 68;
+					m_endIndex = 69;
 				}
-				else if (m_sequence == 37)
+				else if (m_sequence == 8 + m_turboCycles + m_smallCycles)
 				{
 					// Put eggs back to box
 					commandIndex = 29;
@@ -249,10 +174,15 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					// Back to start
 					m_column++;
 					m_sequence = 0;
+					Telemetry_Loop();
 				}
+
+				// Report the newly selected sequence
+				Telemetry_Sequence(commandIndex, m_endIndex);
 			}
 
 			memcpy_P(&tempCommand, &(m_command[commandIndex]), sizeof(Command));
+			Timing_Apply(&tempCommand);
 			switch (tempCommand.button)
 			{
 				case UP:
@@ -291,6 +221,11 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					ReportData->Button |= SWITCH_R;
 					break;
 
+				case SPIN:
+					Spin_Stick(m_spinAngle, &ReportData->LX, &ReportData->LY);
+					m_spinAngle += m_spinSpeed;
+					break;
+
 				/*case L:
 					ReportData->Button |= SWITCH_L;
 					break;
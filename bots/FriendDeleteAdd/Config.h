@@ -1,2 +1,2 @@
-unsigned int m_deleteCount = 3; // How many friends to delete
-bool m_addFriend = false; // Add friends after deleting
+static const unsigned int m_deleteCount = 3; // How many friends to delete
+static const bool m_addFriend = false; // Add friends after deleting
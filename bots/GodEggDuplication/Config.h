@@ -1,4 +1,4 @@
 // WARNING: You are not adviced to change this manually
 // Please run AutoControllerHelper tool!!!
 
-int m_maxCycle = 20;
+static const int m_maxCycle = 20;
@@ -1,3 +1,2 @@
-// WARNING: You are not adviced to change this manually
-// Please run AutoControllerHelper tool!!!
-
+static const int m_boxCount = 3; // Number of boxes to release, 1 to 3 (the release limit)
+static const uint8_t m_lastBoxCount = 30; // Pokemon in the last box, filled in reading order, the empty slots after them are skipped
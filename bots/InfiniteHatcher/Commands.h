@@ -43,8 +43,8 @@ static const Command m_command[] PROGMEM = {
 	{UP_RIGHT,   110}, // 26 - move to spinning spot
 
 	// spinner
-	{ZL,           1}, // 27 - ZL repurposed to be UP_LEFT + A
-	{UP_LEFT,     19}, // 28 - go to 27 until done spinning, then if we need more eggs, go to 3, if not, go to 29
+	{SPIN_A,       1}, // 27 - spin, A for the hatch dialogues
+	{SPIN,        19}, // 28 - go to 27 until done spinning, then if we need more eggs, go to 3, if not, go to 29
 
 	// Put hatched mons away
 	{NOTHING,     20}, // 29
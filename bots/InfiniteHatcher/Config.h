@@ -1,2 +1,5 @@
-uint8_t m_boxesToFill = 5;
-uint8_t m_eggStepGroup = 3;
+static const uint8_t m_boxesToFill = 5;
+static const uint16_t m_eggSteps = 5120; // Steps the species takes to hatch, see EggHatcher/EggCycles.txt
+static const bool m_flameBody = true; // The party Pokemon has Flame Body, Magma Armor or Steam Engine
+static const uint8_t m_spinSpeed = 8; // How far the stick turns each report, in 1/256 of a turn (8 is about two turns a second)
+static const uint16_t m_eggsPerHour = 0; // Target rate the eggs are picked up at, 0 for as fast as they are ready
@@ -17,6 +17,8 @@ these buttons for our use.
 */
 
 #include "../Joystick.h"
+#include "EggSteps.h"
+#include "Spin.h"
 #include "Commands.h"
 #include "Config.h"
 
@@ -24,7 +26,7 @@ these buttons for our use.
 // INSTRUCTIONS
 // -> Your player must be on their bicycle in Bridge Field, no menus or dialogues open
 // -> You must have ONLY 1 pokemon in your party
-// -> The pokemon in your party needs to have Flame Body, Magma Armor, or Steam Engine
+// -> The pokemon in your party should have Flame Body, Magma Armor, or Steam Engine (set m_flameBody)
 // -> You must be disconnected from the internet
 // -> Your cursor must be over "Town Map" in the main menu (game remembers its position)
 // -> Your main menu must be the default without menu items moved around!
@@ -44,116 +46,6 @@ these buttons for our use.
 // -> For reasons mentioned above, it is highly recommended that you have the oval charm.
 
 
-// Main entry point.
-int main(void) {
-	// We'll start by performing hardware and peripheral setup.
-	SetupHardware();
-	// We'll then enable global interrupts for our use.
-	GlobalInterruptEnable();
-	// Once that's done, we'll enter an infinite loop.
-	for (;;)
-	{
-		// We need to run our task to process and deliver data for our IN and OUT endpoints.
-		HID_Task();
-		// We also need to run the main USB management task.
-		USB_USBTask();
-	}
-}
-
-// Configures hardware and peripherals, such as the USB peripherals.
-void SetupHardware(void) {
-	// We need to disable watchdog if enabled by bootloader/fuses.
-	MCUSR &= ~(1 << WDRF);
-	wdt_disable();
-
-	// We need to disable clock division before initializing the USB hardware.
-	//clock_prescale_set(clock_div_1);
-	// We can then initialize our hardware and peripherals, including the USB stack.
-
-	#ifdef ALERT_WHEN_DONE
-	// Both PORTD and PORTB will be used for the optional LED flashing and buzzer.
-	#warning LED and Buzzer functionality enabled. All pins on both PORTB and \
-PORTD will toggle when printing is done.
-	DDRD  = 0xFF; //Teensy uses PORTD
-	PORTD =  0x0;
-                  //We'll just flash all pins on both ports since the UNO R3
-	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
-	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
-	#endif
-	// The USB stack should be initialized last.
-	USB_Init();
-}
-
-// Fired to indicate that the device is enumerating.
-void EVENT_USB_Device_Connect(void) {
-	// We can indicate that we're enumerating here (via status LEDs, sound, etc.).
-}
-
-// Fired to indicate that the device is no longer connected to a host.
-void EVENT_USB_Device_Disconnect(void) {
-	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
-}
-
-// Fired when the host set the current configuration of the USB device after enumeration.
-void EVENT_USB_Device_ConfigurationChanged(void) {
-	bool ConfigSuccess = true;
-
-	// We setup the HID report endpoints.
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
-
-	// We can read ConfigSuccess to indicate a success or failure at this point.
-}
-
-// Process control requests sent to the device from the USB host.
-void EVENT_USB_Device_ControlRequest(void) {
-	// We can handle two control requests: a GetReport and a SetReport.
-
-	// Not used here, it looks like we don't receive control request from the Switch.
-}
-
-// Process and deliver data from IN and OUT endpoints.
-void HID_Task(void) {
-	// If the device isn't connected and properly configured, we can't do anything here.
-	if (USB_DeviceState != DEVICE_STATE_Configured)
-		return;
-
-	// We'll start with the OUT endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
-	// We'll check to see if we received something on the OUT endpoint.
-	if (Endpoint_IsOUTReceived())
-	{
-		// If we did, and the packet has data, we'll react to it.
-		if (Endpoint_IsReadWriteAllowed())
-		{
-			// We'll create a place to store our data received from the host.
-			USB_JoystickReport_Output_t JoystickOutputData;
-			// We'll then take in that data, setting it up in our storage.
-			while(Endpoint_Read_Stream_LE(&JoystickOutputData, sizeof(JoystickOutputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-			// At this point, we can react to this data.
-
-			// However, since we're not doing anything with this data, we abandon it.
-		}
-		// Regardless of whether we reacted to the data, we acknowledge an OUT packet on this endpoint.
-		Endpoint_ClearOUT();
-	}
-
-	// We'll then move on to the IN endpoint.
-	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
-	// We first check to see if the host is ready to accept data.
-	if (Endpoint_IsINReady())
-	{
-		// We'll create an empty report.
-		USB_JoystickReport_Input_t JoystickInputData;
-		// We'll then populate this report with what we want to send to the host.
-		GetNextReport(&JoystickInputData);
-		// Once populated, we can output this data to the host. We do this by first writing the data to the control stream.
-		while(Endpoint_Write_Stream_LE(&JoystickInputData, sizeof(JoystickInputData), NULL) != ENDPOINT_RWSTREAM_NoError);
-		// We then send an IN packet on this endpoint.
-		Endpoint_ClearIN();
-	}
-}
-
 typedef enum {
 	PROCESS,
 	DONE
@@ -172,41 +64,76 @@ const int8_t LAST_COMMAND = (sizeof(m_command) / sizeof(m_command[0])) - 1; // u
 int8_t m_commandIndex = 0;    // current executing command
 int8_t m_endIndex = 26;       // last command to execute in sequence, then we check for new command
 int8_t m_eggCount = 0;        // how many eggs we are holding right now
-int16_t m_spinCount = 0;      // how many times we have spun this iteration
-int16_t m_spinMax = 0;        // how many times we need to spin to move on
-int8_t m_phase = 0;           // 0 = collecting, 1 = hatching
+int8_t m_eggsHatched = 0;     // how many of them have hatched
+int8_t m_eggsPerParty = 5;    // eggs we pick up before putting them away
 int8_t m_columnPosition = 0;  // where the cursor is in the boxes menu
 int8_t m_nextColumn = 1;      // where we want the cursor to be to drop the pokemon
 int8_t m_boxesFilled = 0;     // number of boxes we filled up
 int m_hatchSecs = 0;
+uint8_t m_spinAngle = 0;      // where the stick is on its circle
+
+// The scheduler counts in spins, half a second of spinning each. Eggs hatch on
+// the steps ridden since they were picked up, trips to the nursery included.
+// The trip figures are estimates, not measurements: the party sizes are picked
+// so that no egg is due before the last pickup, and they only hold the bot
+// back when m_eggsPerHour spaces the pickups out.
+#define EGGS_PER_PARTY   5
+#define EGG_SPINS       14 // 7 seconds of spinning should be enough for the next egg
+#define TRIP_SPINS      36 // a trip to the nursery takes about as long as 36 spins
+#define TRIP_STEP_SPINS  7 // and rides about as far as 7 spins
+#define HATCH_SLACK     40 // an egg can hatch this many spins before it is due
+
+int16_t m_clock = 0;          // spins of steps since the party was emptied
+int16_t m_eggDue[EGGS_PER_PARTY]; // when each egg we hold is sure to have hatched
+int16_t m_nextCollect = 0;    // when we go get the next egg
+int16_t m_hatchSpins = 0;     // spins until an egg is sure to have hatched
+int16_t m_collectSpins = EGG_SPINS; // spins between eggs, slower for m_eggsPerHour
+
+// Seconds of spinning until the eggs of each egg step group hatch
+static const uint8_t m_groupHatchSecs[] PROGMEM = {0, 80, 133, 145, 165, 175, 195, 210};
+#define HATCH_GROUPS (sizeof(m_groupHatchSecs) / sizeof(m_groupHatchSecs[0]))
+
+// Work out how long to spin for the eggs' steps.
+void SetupBot(void) {
+  uint8_t group = EggSteps_Group(m_eggSteps, m_flameBody);
+  if (group < HATCH_GROUPS)
+  {
+    m_hatchSecs = pgm_read_byte(&m_groupHatchSecs[group]);
+  }
+  else
+  {
+    // Past the tuned groups, about 16 more seconds per group
+    m_hatchSecs = pgm_read_byte(&m_groupHatchSecs[HATCH_GROUPS - 1]) + (group - (HATCH_GROUPS - 1)) * 16;
+  }
+
+  m_hatchSpins = m_hatchSecs * 2; // 2 spins per second
+
+  // 2560 step eggs hatch before we could pick up 5
+  if (group == 1)
+  {
+    m_eggsPerParty = 3;
+  }
+
+  // Pick up eggs no faster than the target rate
+  uint16_t eggsPerHour = m_eggsPerHour;
+  if (eggsPerHour && 7200 / eggsPerHour > EGG_SPINS + TRIP_SPINS)
+  {
+    m_collectSpins = 7200 / eggsPerHour - TRIP_SPINS;
+  }
+}
+
+// Whether the next egg to hatch is far enough off that we can ride to the
+// nursery and back without it hatching on the way.
+bool CanLeave(void) {
+  if (m_eggsHatched == m_eggCount)
+  {
+    return true;
+  }
+  return m_eggDue[m_eggsHatched] - HATCH_SLACK > m_clock + TRIP_STEP_SPINS;
+}
 
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
-  switch (m_eggStepGroup) {
-    case 1:
-      m_hatchSecs = 80;
-      break;
-    case 2:
-      m_hatchSecs = 133;
-      break;
-    case 3:
-      m_hatchSecs = 145;
-      break;
-    case 4:
-      m_hatchSecs = 165;
-      break;
-    case 5:
-      m_hatchSecs = 175;
-      break;
-    case 6:
-      m_hatchSecs = 195;
-      break;
-    case 7:
-      m_hatchSecs = 210;
-      break;
-    default:
-      break;
-  }
 
 	// Prepare an empty report
 	memset(ReportData, 0, sizeof(USB_JoystickReport_Input_t));
@@ -242,44 +169,38 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 			{
 				if (m_endIndex == 26) // we just picked up an egg (hopefully)
 				{
-				    m_eggCount++;
+					m_clock += TRIP_STEP_SPINS;
+					m_eggDue[m_eggCount] = m_clock + m_hatchSpins;
+					m_eggCount++;
+					m_nextCollect = m_clock + m_collectSpins;
+
+					m_commandIndex = 27; // spin
+					m_endIndex = 28;
+				}
+				else if (m_endIndex == 28) // We are spinning
+				{
+					m_clock++;
 
-					if (m_eggCount < (m_eggStepGroup == 1 ? 3 : 5))
+					// The eggs hatch in the order we picked them up
+					while (m_eggsHatched < m_eggCount && m_clock >= m_eggDue[m_eggsHatched])
 					{
-						m_commandIndex = 27; // spin
-						m_endIndex = 28;
-						m_spinCount = 0;
-						m_spinMax = 14; // 2 "spins" per second (7 seconds should be enough for next egg)
+						m_eggsHatched++;
+						Telemetry_Loop();
 					}
-					else
+
+					if (m_eggsHatched == m_eggsPerParty)
 					{
-						m_phase = 1; // set to hatching phase
-						m_commandIndex = 27; // spin
-						m_endIndex = 28;
-						m_spinCount = 0;
-						m_spinMax = m_hatchSecs * 2; // 2 "spins" per second
+						m_commandIndex = 29; // put mon in boxes
+						m_endIndex = 63;
 					}
-				}
-				else if (m_endIndex == 28) // We are spinning
-				{
-					m_spinCount++;
-					if (m_spinCount < m_spinMax)
+					else if (m_eggCount < m_eggsPerParty && m_clock >= m_nextCollect && CanLeave())
 					{
-						m_commandIndex = 27; // keep spinning
+						m_commandIndex = 3; // go back to get an egg
+						m_endIndex = 26;
 					}
 					else
 					{
-						if (m_phase == 0) // we are still collecting
-						{
-							m_commandIndex = 3; // go back to get an egg
-							m_endIndex = 26;
-						}
-						else
-						{
-							m_commandIndex = 29; // put mon in boxes
-							m_endIndex = 63;
-							m_phase = 0; // set to egg collecting phase
-						}
+						m_commandIndex = 27; // keep spinning
 					}
 				}
 				else if (m_endIndex == 63) // We opened the pokemon menu, selected the pokemon, and moved right
@@ -314,13 +235,19 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 				else if (m_endIndex == 77) // We finished putting away the hatched mon and are in the menu
 				{
 					m_eggCount = 0;
+					m_eggsHatched = 0;
+					m_clock = 0;
 					m_columnPosition = 0;
 					m_commandIndex = 5; // start over!
 					m_endIndex = 26;
 				}
+
+				// Report the newly selected sequence
+				Telemetry_Sequence(m_commandIndex, m_endIndex);
 			}
 
 			memcpy_P(&tempCommand, &(m_command[m_commandIndex]), sizeof(Command));
+			Timing_Apply(&tempCommand);
 			switch (tempCommand.button)
 			{
 				case UP:
@@ -344,9 +271,15 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					ReportData->LX = STICK_MAX;
 					break;
 
-				case UP_LEFT:
-					ReportData->LY = STICK_MIN;
-					ReportData->RX = STICK_MIN;
+				case SPIN:
+					Spin_Stick(m_spinAngle, &ReportData->LX, &ReportData->LY);
+					m_spinAngle += m_spinSpeed;
+					break;
+
+				case SPIN_A:
+					ReportData->Button |= SWITCH_A;
+					Spin_Stick(m_spinAngle, &ReportData->LX, &ReportData->LY);
+					m_spinAngle += m_spinSpeed;
 					break;
 
 				case X:
@@ -374,9 +307,7 @@ void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
 					break;
 
 				case ZL:
-					ReportData->Button |= SWITCH_A;
-					ReportData->LY = STICK_MIN;
-					ReportData->RX = STICK_MIN;
+					ReportData->Button |= SWITCH_ZL;
 					break;
 
 				case ZR:
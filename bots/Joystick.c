@@ -0,0 +1,226 @@
+/*
+Pokemon Sword & Shield Controller - Shared USB Boilerplate
+
+Based on the LUFA library's Low-Level Joystick Demo
+	(C) Dean Camera
+Based on the HORI's Pokken Tournament Pro Pad design
+	(C) HORI
+
+This project implements a modified version of HORI's Pokken Tournament Pro Pad
+USB descriptors to allow for the creation of custom controllers for the
+Nintendo Switch. This also works to a limited degree on the PS3.
+
+Every bot links against this file and only provides GetNextReport (and,
+optionally, SetupBot). The next report is built in the main loop while the
+previous one is still waiting to be polled, so the IN endpoint only ever
+has to copy a finished report.
+
+Built with USB_INTERRUPT=Y, control requests are handled by LUFA's USB_COM
+interrupt and the HID endpoints are serviced from the Start Of Frame
+interrupt, so the main loop does nothing but build reports.
+*/
+
+#include "Joystick.h"
+
+// Report that will be sent on the next IN poll, and whether it has been built yet.
+static USB_JoystickReport_Input_t m_nextReport;
+static volatile bool m_nextReportReady = false;
+
+// Host poll cadence measurement, taken from the USB frame counter (1 frame = 1 ms).
+#define POLL_WINDOW 64
+static uint16_t m_lastPollFrame;
+static uint16_t m_windowFrames;
+static uint8_t m_windowReports;
+static uint16_t m_pollCadence;
+static uint32_t m_uptimeMS;
+
+// Main entry point.
+int main(void) {
+	// We'll start by performing hardware and peripheral setup.
+	SetupHardware();
+	// We'll let the bot prepare any state it needs before the first report.
+	SetupBot();
+	// We'll then enable global interrupts for our use.
+	GlobalInterruptEnable();
+	// Once that's done, we'll enter an infinite loop.
+	for (;;)
+	{
+		uint16_t loopBegin = Benchmark_Begin();
+		// We prepare the next report while the previous one is in flight.
+		if (!m_nextReportReady)
+		{
+			uint16_t reportBegin = Benchmark_Begin();
+			GetNextReport(&m_nextReport);
+			Benchmark_End(BENCHMARK_REPORT, reportBegin);
+			m_nextReportReady = true;
+		}
+		// We let the optional telemetry report our status.
+		Telemetry_Task();
+		// We write one byte of any pending checkpoint.
+		Checkpoint_Task();
+		#ifndef USB_INTERRUPT_DRIVEN
+		// We need to run our task to process and deliver data for our IN and OUT endpoints.
+		uint16_t hidBegin = Benchmark_Begin();
+		HID_Task();
+		Benchmark_End(BENCHMARK_HID_TASK, hidBegin);
+		// We also need to run the main USB management task.
+		USB_USBTask();
+		#endif
+		#ifdef BENCHMARK
+		// There is no host in simavr to take the report, so every iteration stands for a poll.
+		m_nextReportReady = false;
+		#endif
+		Benchmark_End(BENCHMARK_LOOP, loopBegin);
+		Benchmark_Poll();
+	}
+}
+
+// Configures hardware and peripherals, such as the USB peripherals.
+void SetupHardware(void) {
+	// We need to disable watchdog if enabled by bootloader/fuses.
+	MCUSR &= ~(1 << WDRF);
+	wdt_disable();
+
+	// We need to disable clock division before initializing the USB hardware.
+	//clock_prescale_set(clock_div_1);
+	// We can then initialize our hardware and peripherals, including the USB stack.
+
+	#ifdef ALERT_WHEN_DONE
+	// Both PORTD and PORTB will be used for the optional LED flashing and buzzer.
+	#warning LED and Buzzer functionality enabled. All pins on both PORTB and \
+PORTD will toggle when printing is done.
+	DDRD  = 0xFF; //Teensy uses PORTD
+	PORTD =  0x0;
+                  //We'll just flash all pins on both ports since the UNO R3
+	DDRB  = 0xFF; //uses PORTB. Micro can use either or, but both give us 2 LEDs
+	PORTB =  0x0; //The ATmega328P on the UNO will be resetting, so unplug it?
+	#endif
+	// The optional telemetry USART.
+	Telemetry_Init();
+	// The optional benchmark timer.
+	Benchmark_Init();
+	// The USB stack should be initialized last.
+	USB_Init();
+	#ifdef BENCHMARK
+	// simavr never enumerates us, but HID_Task should still run its endpoint checks.
+	USB_DeviceState = DEVICE_STATE_Configured;
+	#endif
+}
+
+// Bots that need to initialize state at boot override this.
+void __attribute__((weak)) SetupBot(void) {
+}
+
+// Common/Checkpoint.c overrides this when it is linked in.
+void __attribute__((weak)) Checkpoint_Task(void) {
+}
+
+// Fired to indicate that the device is enumerating.
+void EVENT_USB_Device_Connect(void) {
+	// We can indicate that we're enumerating here (via status LEDs, sound, etc.).
+}
+
+// Fired to indicate that the device is no longer connected to a host.
+void EVENT_USB_Device_Disconnect(void) {
+	// We can indicate that our device is not ready (via status LEDs, sound, etc.).
+}
+
+// Fired when the host set the current configuration of the USB device after enumeration.
+void EVENT_USB_Device_ConfigurationChanged(void) {
+	bool ConfigSuccess = true;
+
+	// We setup the HID report endpoints.
+	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_OUT_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
+	ConfigSuccess &= Endpoint_ConfigureEndpoint(JOYSTICK_IN_EPADDR, EP_TYPE_INTERRUPT, JOYSTICK_EPSIZE, 1);
+
+	// We restart the poll cadence measurement from this frame.
+	m_lastPollFrame = USB_Device_GetFrameNumber();
+	m_windowFrames = 0;
+	m_windowReports = 0;
+
+	#ifdef USB_INTERRUPT_DRIVEN
+	// The HID endpoints are serviced once per frame from the SOF interrupt.
+	USB_Device_EnableSOFEvents();
+	#endif
+
+	// We can read ConfigSuccess to indicate a success or failure at this point.
+}
+
+#ifdef USB_INTERRUPT_DRIVEN
+// Fired every millisecond at the start of each USB frame.
+void EVENT_USB_Device_StartOfFrame(void) {
+	HID_Task();
+}
+#endif
+
+// Process control requests sent to the device from the USB host.
+void EVENT_USB_Device_ControlRequest(void) {
+	// We can handle two control requests: a GetReport and a SetReport.
+
+	// Not used here, it looks like we don't receive control request from the Switch.
+}
+
+// Process and deliver data from IN and OUT endpoints.
+void HID_Task(void) {
+	// If the device isn't connected and properly configured, we can't do anything here.
+	if (USB_DeviceState != DEVICE_STATE_Configured)
+		return;
+
+	// We may have interrupted a control request, so we put its endpoint back when done.
+	uint8_t PrevSelectedEndpoint = Endpoint_GetCurrentEndpoint();
+
+	// We'll start with the OUT endpoint.
+	Endpoint_SelectEndpoint(JOYSTICK_OUT_EPADDR);
+	// We'll check to see if we received something on the OUT endpoint.
+	if (Endpoint_IsOUTReceived())
+	{
+		// We don't react to the host's output report, so we acknowledge the packet without reading it.
+		Endpoint_ClearOUT();
+	}
+
+	// We'll then move on to the IN endpoint.
+	Endpoint_SelectEndpoint(JOYSTICK_IN_EPADDR);
+	// We only send once the host is ready to accept data and the next report has been built.
+	if (m_nextReportReady && Endpoint_IsINReady())
+	{
+		// The bank is free and the report fits in it, so this single write never waits.
+		Endpoint_Write_Stream_LE(&m_nextReport, sizeof(m_nextReport), NULL);
+		// We then send an IN packet on this endpoint.
+		Endpoint_ClearIN();
+		// The main loop can now start building the following report.
+		m_nextReportReady = false;
+
+		// The host took the previous report, so the frames since then are one poll interval.
+		uint16_t frame = USB_Device_GetFrameNumber();
+		uint16_t elapsed = (frame - m_lastPollFrame) & 0x7FF;
+		m_lastPollFrame = frame;
+		m_uptimeMS += elapsed;
+		m_windowFrames += elapsed;
+		if (++m_windowReports == POLL_WINDOW)
+		{
+			m_pollCadence = m_windowFrames;
+			m_windowFrames = 0;
+			m_windowReports = 0;
+		}
+	}
+
+	Endpoint_SelectEndpoint(PrevSelectedEndpoint);
+}
+
+// Average time between host polls over the last POLL_WINDOW reports, in 1/64 ms (0 until measured).
+uint16_t GetPollCadence(void) {
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+	uint16_t cadence = m_pollCadence;
+	SetGlobalInterruptMask(CurrentGlobalInt);
+	return cadence;
+}
+
+// Time the host has been polling us, in ms.
+uint32_t GetUptimeMS(void) {
+	uint_reg_t CurrentGlobalInt = GetGlobalInterruptMask();
+	GlobalInterruptDisable();
+	uint32_t uptime = m_uptimeMS;
+	SetGlobalInterruptMask(CurrentGlobalInt);
+	return uptime;
+}
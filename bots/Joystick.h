@@ -51,6 +51,10 @@
 #include <LUFA/Platform/Platform.h>
 
 #include "Descriptors.h"
+#include "Telemetry.h"
+#include "Checkpoint.h"
+#include "Random.h"
+#include "Benchmark.h"
 
 // Type Defines
 // Enumeration for joystick buttons.
@@ -143,6 +147,11 @@ typedef enum {
 	NOTHING,
   DOWN_LEFT,
   DOWN_RIGHT,
+	WAIT,	// NOTHING on the game's own clock, never scaled by the timing profile
+	A_SPAM,	// A every other pair of reports, until a screen takes it (see SoftReset.h)
+	B_SPAM,	// B every other pair of reports, to get through dialogue as fast as it prints
+	SPIN,	// Left stick around a circle, on the bike (see Spin.h)
+	SPIN_A,	// SPIN while pressing A
 } Buttons_t;
 
 // Structure used for button array sequence
@@ -151,10 +160,16 @@ typedef struct {
 	uint16_t duration;
 } Command;
 
+// Scaling of the waits for the console's timing profile.
+#include "Timing.h"
+
 // Function Prototypes
 // Setup all necessary hardware, including USB initialization.
 void SetupHardware(void);
 
+// Initialize bot state at boot. Optional, a bot only defines it when needed.
+void SetupBot(void);
+
 // Process and deliver data from IN and OUT endpoints.
 void HID_Task(void);
 
@@ -166,4 +181,10 @@ void EVENT_USB_Device_ControlRequest(void);
 
 // Prepare the next report for the host.
 void GetNextReport(USB_JoystickReport_Input_t* const ReportData);
+
+// Measured host poll cadence, in 1/64 ms per report.
+uint16_t GetPollCadence(void);
+
+// Time the host has been polling us, in ms.
+uint32_t GetUptimeMS(void);
 #endif
@@ -1,5 +1,9 @@
 #include "../Joystick.h"
 #include <avr/pgmspace.h>
+#include "SoftReset.h"
+
+// Where SOFTRESET_COMMANDS is in m_command
+#define SOFTRESET 31
 
 static const Command m_command[] PROGMEM = {
 	//----------Setup [0,2]----------
@@ -38,16 +42,6 @@ static const Command m_command[] PROGMEM = {
 	{HOME, 1},
 	{NOTHING, 300},
 
-	//----------SR [31,41]----------
-	{X, 1},			// Close game
-	{NOTHING, 8},
-	{A, 1},			// Comfirm close game
-	{NOTHING, 120},
-	{A, 1},			// Choose game
-	{NOTHING, 50},
-	{A, 1},			// Pick User
-	{NOTHING, 800},
-	{NOTHING, 280}, // Extra wait time if m_titleScreenBuffer is true
-	{A, 1},			// Enter game
-	{NOTHING, 460},
+	//----------SR [31,38]----------
+	SOFTRESET_COMMANDS,
 };
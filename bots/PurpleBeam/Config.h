@@ -1,3 +1,3 @@
 // WARNING: You are not adviced to change this manually
 // Please run AutoControllerHelper tool!!!
-bool m_titleScreenBuffer = true;
+static const bool m_titleScreenBuffer = true;
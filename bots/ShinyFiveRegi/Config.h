@@ -1,5 +1,5 @@
 // WARNING: You are not adviced to change this manually
 // Please run AutoControllerHelper tool!!!
 
-uint8_t m_type = 3;
-bool m_fastMode = false;
+static const uint8_t m_type = 3;
+static const bool m_fastMode = false;
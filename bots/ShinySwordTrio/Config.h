@@ -1,4 +1,4 @@
 // WARNING: You are not adviced to change this manually
 // Please run AutoControllerHelper tool!!!
 
-bool m_fastMode = true;
+static const bool m_fastMode = true;
@@ -0,0 +1,61 @@
+#include "../Joystick.h"
+#include <avr/pgmspace.h>
+#include "DateTime.h"
+
+// Where DATETIME_COMMANDS is in m_command
+#define DATETIME 3
+
+static const Command m_command[] PROGMEM = {
+	//----------Setup [0,2]----------
+	// Press B once to connect
+	{NOTHING, 30},
+	{B, 1},
+	{NOTHING, 1},
+
+	//----------Sync and unsync time, plus 1 year, back to game [3,56]----------
+	DATETIME_COMMANDS(NOTHING, 12),
+
+	//----------Collect Watts [57,64]----------
+	{A, 12},
+	{NOTHING, 1},
+	{B, 6},
+	{NOTHING, 1},
+	{B, 30},
+	{NOTHING, 1},
+	{B, 1},
+	{NOTHING, 50},
+
+	//----------Walk to the berry tree [65]----------
+	{UP, 1},		// Away from the den, set by m_denDirection and m_treeTime
+
+	//----------Collect Berry [66,83]----------
+	{A, 16},		// It's a Berry tree. Do you want to shake it?
+	{NOTHING, 1},
+	{A, 12},
+	{NOTHING, 1},
+	{A, 170},		// Yes
+	{NOTHING, 1},
+	{B, 30},		// X fell from the tree!
+	{NOTHING, 1},
+	{B, 65},		// There are X Berries on the ground. Quit
+	{NOTHING, 1},
+	{B, 16},		// You picked up the Betties that fell from the tree!
+	{NOTHING, 1},
+	{B, 16},
+	{NOTHING, 1},
+	{B, 16},
+	{NOTHING, 1},
+	{B, 16},
+	{NOTHING, 14},
+
+	//----------Walk back to the den [84]----------
+	{DOWN, 1},		// Towards the den, set by m_denDirection and m_treeTime
+
+	//----------Save Game [85,90]----------
+	{X, 1},
+	{NOTHING, 20},
+	{R, 1},
+	{NOTHING, 50},
+	{A, 1},
+	{NOTHING, 140}
+};
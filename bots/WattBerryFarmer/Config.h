@@ -0,0 +1,4 @@
+static const uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
+static const uint8_t m_denDirection = 0; // Direction to face the den: 0 = up, 1 = right, 2 = down, 3 = left
+static const uint16_t m_treeTime = 40; // How long to walk from the den to the berry tree behind it
+static const uint16_t m_maxLossMinutes = 15; // Most farming time a crash can lose, the bot saves as rarely as that allows
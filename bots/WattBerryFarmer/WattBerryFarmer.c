@@ -0,0 +1,270 @@
+/*
+Pokemon Sword & Shield Watt and Berry Farmer - Proof-of-Concept
+
+Based on the LUFA library's Low-Level Joystick Demo
+	(C) Dean Camera
+Based on the HORI's Pokken Tournament Pro Pad design
+	(C) HORI
+
+This project implements a modified version of HORI's Pokken Tournament Pro Pad
+USB descriptors to allow for the creation of custom controllers for the
+Nintendo Switch. This also works to a limited degree on the PS3.
+
+Since System Update v3.0.0, the Nintendo Switch recognizes the Pokken
+Tournament Pro Pad as a Pro Controller. Physical design limitations prevent
+the Pokken Controller from functioning at the same level as the Pro
+Controller. However, by default most of the descriptors are there, with the
+exception of Home and Capture. Descriptor modification allows us to unlock
+these buttons for our use.
+*/
+
+#include "../Joystick.h"
+#include "Commands.h"
+#include "SavePolicy.h"
+#include "Config.h"
+
+typedef enum {
+	PROCESS,
+	DONE
+} State_t;
+State_t state = PROCESS;
+
+#define ECHOES 2
+int echoes = 0;
+USB_JoystickReport_Input_t last_report;
+
+Command tempCommand;
+int durationCount = 0;
+
+// start and end index of "Setup"
+int commandIndex = 0;
+int m_endIndex = 2;
+int m_sequence = 0;
+
+// Walks between the den and the berry tree, in m_command
+#define WALK_TO_TREE 65
+#define WALK_TO_DEN  84
+// Extra time walking back, so we bump into the den and face it
+#define WALK_SLACK   10
+
+// Stick directions for m_denDirection
+static const Buttons_t m_directions[4] = {UP, RIGHT, DOWN, LEFT};
+
+// Save as rarely as the farming time we can lose allows.
+void SetupBot(void) {
+	SavePolicy_Init(m_maxLossMinutes);
+}
+
+// Prepare the next report for the host.
+void GetNextReport(USB_JoystickReport_Input_t* const ReportData) {
+
+	// Prepare an empty report
+	memset(ReportData, 0, sizeof(USB_JoystickReport_Input_t));
+	ReportData->LX = STICK_CENTER;
+	ReportData->LY = STICK_CENTER;
+	ReportData->RX = STICK_CENTER;
+	ReportData->RY = STICK_CENTER;
+	ReportData->HAT = HAT_CENTER;
+
+	// Repeat ECHOES times the last report
+	if (echoes > 0)
+	{
+		memcpy(ReportData, &last_report, sizeof(USB_JoystickReport_Input_t));
+		echoes--;
+		return;
+	}
+
+	// States and moves management
+	switch (state)
+	{
+		case PROCESS:
+			// Get the next command sequence (new start and end)
+			if (commandIndex == -1)
+			{
+				m_sequence++;
+				if (m_sequence == 5 && !SavePolicy_Collected())
+				{
+					// Not time to save yet
+					m_sequence = 1;
+				}
+				else if (m_sequence == 6)
+				{
+					SavePolicy_Saved();
+					m_sequence = 1;
+				}
+
+				if (m_sequence == 1)
+				{
+					// sync and unsync time
+					commandIndex = DATETIME + DATETIME_SETTINGS;
+					m_endIndex = DATETIME + DATETIME_PICKER_END;
+				}
+				else if (m_sequence == 2)
+				{
+					// Plus 1 year
+					commandIndex = DATETIME + DATETIME_PLUS_YEAR(m_JP_EU_US);
+					m_endIndex = DATETIME + DATETIME_CONFIRM_END;
+				}
+				else if (m_sequence == 3)
+				{
+					// collect watts
+					commandIndex = DATETIME + DATETIME_BACK;
+					m_endIndex = 64;
+				}
+				else if (m_sequence == 4)
+				{
+					// walk to the tree, collect berries and walk back, on the same day
+					commandIndex = WALK_TO_TREE;
+					m_endIndex = WALK_TO_DEN;
+					Telemetry_Loop();
+				}
+				else if (m_sequence == 5)
+				{
+					// save game
+					commandIndex = 85;
+					m_endIndex = 90;
+				}
+
+				// Report the newly selected sequence
+				Telemetry_Sequence(commandIndex, m_endIndex);
+			}
+
+			memcpy_P(&tempCommand, &(m_command[commandIndex]), sizeof(Command));
+			Timing_Apply(&tempCommand);
+
+			// The tree is behind us when we face the den
+			if (commandIndex == WALK_TO_TREE)
+			{
+				tempCommand.button = m_directions[(m_denDirection + 2) % 4];
+				tempCommand.duration = m_treeTime;
+			}
+			else if (commandIndex == WALK_TO_DEN)
+			{
+				tempCommand.button = m_directions[m_denDirection % 4];
+				tempCommand.duration = m_treeTime + WALK_SLACK;
+			}
+
+			switch (tempCommand.button)
+			{
+				case UP:
+					ReportData->LY = STICK_MIN;
+					break;
+
+				case UP_A:
+					ReportData->LY = STICK_MIN;
+          ReportData->Button |= SWITCH_A;
+					break;
+
+				case LEFT:
+					ReportData->LX = STICK_MIN;
+					break;
+
+				case DOWN:
+					ReportData->LY = STICK_MAX;
+					break;
+
+				case RDOWN:
+					ReportData->RY = STICK_MAX;
+					break;
+
+				case RIGHT:
+					ReportData->LX = STICK_MAX;
+					break;
+
+				case RRIGHT:
+					ReportData->RX = STICK_MAX;
+					break;
+
+				case RIGHT_A:
+					ReportData->LX = STICK_MAX;
+          ReportData->Button |= SWITCH_A;
+					break;
+
+				case X:
+					ReportData->Button |= SWITCH_X;
+					break;
+
+				case Y:
+					ReportData->Button |= SWITCH_Y;
+					break;
+
+				case A:
+					ReportData->Button |= SWITCH_A;
+					break;
+
+				case B:
+					ReportData->Button |= SWITCH_B;
+					break;
+
+				/*case L:
+					ReportData->Button |= SWITCH_L;
+					break;*/
+
+				case R:
+					ReportData->Button |= SWITCH_R;
+					break;
+
+				/*case ZL:
+					ReportData->Button |= SWITCH_ZL;
+					break;
+
+				case ZR:
+					ReportData->Button |= SWITCH_ZR;
+					break;
+
+				case MINUS:
+					ReportData->Button |= SWITCH_MINUS;
+					break;
+
+				case PLUS:
+					ReportData->Button |= SWITCH_PLUS;
+					break;
+
+				case LCLICK:
+					ReportData->Button |= SWITCH_LCLICK;
+					break;
+
+				case RCLICK:
+					ReportData->Button |= SWITCH_RCLICK;
+					break;*/
+
+				case TRIGGERS:
+					ReportData->Button |= SWITCH_L | SWITCH_R;
+					break;
+
+				case HOME:
+					ReportData->Button |= SWITCH_HOME;
+					break;
+
+				/*case CAPTURE:
+					ReportData->Button |= SWITCH_CAPTURE;
+					break;*/
+
+				default:
+					// really nothing lol
+					break;
+			}
+
+			durationCount++;
+
+			if (durationCount > tempCommand.duration)
+			{
+				commandIndex++;
+				durationCount = 0;
+
+				// We reached the end of a command sequence
+				if (commandIndex > m_endIndex)
+				{
+					commandIndex = -1;
+				}
+			}
+
+			break;
+
+		case DONE: return;
+	}
+
+	// Prepare to echo this report
+	memcpy(&last_report, ReportData, sizeof(USB_JoystickReport_Input_t));
+	echoes = ECHOES;
+}
@@ -1,2 +1,2 @@
-uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
-uint16_t m_saveAt = 50; // How many times to farm before saving for safety
+static const uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
+static const uint16_t m_maxLossMinutes = 15; // Most farming time a crash can lose, the bot saves as rarely as that allows
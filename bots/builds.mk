@@ -0,0 +1,59 @@
+# Rebuilds the pre-compiled hexes in builds/ for every preset and MCU:
+#   make -f builds.mk -j$(nproc)
+#
+# presets/<bot>/<name>.h is the Config.h that builds/<name>.hex is built with.
+# atmega16u2 hexes go to builds/, the ones for other MCUs to builds/<MCU>/.
+# Every build has its own object directory under obj/, so the builds can run
+# in parallel, and the code every bot shares (LUFA, the descriptors,
+# Joystick.c and Common/) is only built once per MCU.
+
+MCUS     = atmega16u2 atmega32u4 at90usb1286
+OBJ      = obj
+PRESETS  = $(wildcard presets/*/*.h)
+SUBMAKE  = $(MAKE) --no-print-directory -f makefile
+
+# presets/AutoHost/AutoHostReroll.h -> AutoHostReroll, AutoHost
+name     = $(basename $(notdir $(1)))
+bot      = $(notdir $(patsubst %/,%,$(dir $(1))))
+# Where the hex of preset $(2) for MCU $(1) goes
+hex      = $(if $(filter atmega16u2,$(1)),builds,builds/$(1))/$(call name,$(2)).hex
+
+all: $(foreach mcu,$(MCUS),$(foreach preset,$(PRESETS),$(call hex,$(mcu),$(preset))))
+
+clean:
+	rm -rf $(OBJ)
+
+# The sub-makes track their own dependencies, so they always run
+FORCE:
+
+.PHONY: all clean FORCE
+
+# $(1) = MCU: the shared code, as an archive the bots link against
+define SHARED_RULE
+$(OBJ)/$(1)/libshared.a: FORCE
+	@mkdir -p $(OBJ)/$(1)/shared
+	+@$(SUBMAKE) $$@ MCU=$(1) TARGET=$(OBJ)/$(1)/shared OBJDIR=$(OBJ)/$(1)/shared 'SRC=$$$$(SHARED_SRC)'
+endef
+
+# $(1) = preset: a copy of the bot's directory with the preset as its Config.h,
+# shared by every MCU. ../Joystick.h has to resolve from it as well.
+define STAGE_RULE
+$(OBJ)/presets/$(call name,$(1))/$(call bot,$(1))/Config.h: $(1)
+	@mkdir -p $$(@D)
+	@ln -sf $(CURDIR)/Joystick.h $(OBJ)/presets/$(call name,$(1))/Joystick.h
+	@ln -sf $(CURDIR)/$(call bot,$(1))/* $$(@D)
+	@rm -f $$@ && cp $$< $$@
+endef
+
+# $(1) = MCU, $(2) = preset
+define PRESET_RULE
+$(call hex,$(1),$(2)): $(OBJ)/$(1)/libshared.a $(OBJ)/presets/$(call name,$(2))/$(call bot,$(2))/Config.h FORCE
+	@mkdir -p $(OBJ)/$(1)/$(call name,$(2)) $$(@D)
+	+@$(SUBMAKE) hex MCU=$(1) TARGET=$(OBJ)/$(1)/$(call name,$(2)) OBJDIR=$(OBJ)/$(1)/$(call name,$(2)) \
+		SRC=$(OBJ)/presets/$(call name,$(2))/$(call bot,$(2))/$(call bot,$(2)).c LD_FLAGS=$(OBJ)/$(1)/libshared.a
+	@cp $(OBJ)/$(1)/$(call name,$(2)).hex $$@
+endef
+
+$(foreach mcu,$(MCUS),$(eval $(call SHARED_RULE,$(mcu))))
+$(foreach preset,$(PRESETS),$(eval $(call STAGE_RULE,$(preset))))
+$(foreach mcu,$(MCUS),$(foreach preset,$(PRESETS),$(eval $(call PRESET_RULE,$(mcu),$(preset)))))
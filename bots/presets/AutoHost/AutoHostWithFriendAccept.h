@@ -0,0 +1,15 @@
+static const bool m_localMode = false; // Skip connecting to internet
+static const uint16_t m_internetTime = 900; // Buffer time to let internet connect
+static const uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
+static const bool m_skip3Days = false; // Re-roll after each raid
+static const bool m_unsafeDC = false;  // Necessary for re-rolling, don't use otherwise
+static const bool m_useLinkCode = false;
+static const bool m_useRandomCode = false;
+static const uint8_t m_seed = 79; // This number will determine the "random" sequence
+static const uint32_t m_linkCodes[] PROGMEM = {0x36963696}; // Set link codes when not using random, one hex digit per code digit
+static const uint8_t m_waitTime = 0;  // 0 to wait until 2-min, 1 to wait until 1-min
+static const bool m_addFriends = true; // Add friends between raids
+static const uint8_t m_profile = 1; // If you have multiple profiles, use this to specify which to use
+static const bool m_alternate = false; // Set this to true to alternate between FFA and coded
+static const bool m_titleScreenBuffer = true; // Set this to true if the title screen takes long to load
+static const bool m_pokemonIsCatchable = true; // Set to false if pokemon is an uncatchable event
@@ -0,0 +1 @@
+// TurboA has no configuration
@@ -0,0 +1,2 @@
+static const uint8_t m_JP_EU_US = 2; // 0 = JP, 1 = EU, 2 = US
+static const uint16_t m_maxLossMinutes = 15; // Most farming time a crash can lose, the bot saves as rarely as that allows
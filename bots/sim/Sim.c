@@ -0,0 +1,303 @@
+/*
+Native simulator for the bots
+
+Runs a bot's firmware (Joystick.c's main loop and the bot's GetNextReport)
+on the host against a simulated USB host. The host polls the IN endpoint
+every POLLING_INTERVAL_MS, as the Switch does, and every report it takes is
+written to stdout with the simulated time it was taken at:
+
+	time_ms buttons hat lx ly rx ry
+
+Sequences selected and loops completed by the bot (the telemetry events)
+are written as comment lines starting with '#'.
+
+Usage: build/<bot> [-t seconds] [-l loops] [-p poll_ms] [-c] [-q] [-e eeprom_file]
+	-t  simulated time to run for (default 3600)
+	-l  stop once this many loops have been completed
+	-p  host poll interval in ms (default POLLING_INTERVAL_MS)
+	-c  only print reports that differ from the previous one
+	-q  don't print reports, only the summary
+	-e  load the EEPROM from this file at start and save it at exit
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../Joystick.h"
+
+// Joystick.c's main is built as Firmware_main
+#undef main
+int Firmware_main(void);
+
+volatile uint8_t MCUSR;
+volatile uint8_t DDRB, PORTB, PINB = 0xFF;
+volatile uint8_t DDRD, PORTD, PIND = 0xFF;
+volatile uint8_t TCCR0A, TCCR0B, TCNT0;
+volatile uint8_t USB_DeviceState = DEVICE_STATE_Unattached;
+
+// Options
+static uint32_t m_endTime = 3600000;
+static uint32_t m_maxLoops = 0;
+static uint16_t m_pollInterval = POLLING_INTERVAL_MS;
+static bool m_changesOnly = false;
+static bool m_quiet = false;
+static const char* m_eepromFile = NULL;
+
+// Simulated time, in ms
+static uint32_t m_now = 0;
+
+// Endpoint state
+static uint8_t m_selectedEndpoint = 0;
+static bool m_inBankFull = false;
+static USB_JoystickReport_Input_t m_inBank;
+
+// Statistics
+static uint32_t m_reports = 0;
+static uint32_t m_changes = 0;
+static uint32_t m_naks = 0;
+static uint32_t m_sequences = 0;
+static uint32_t m_loops = 0;
+static uint32_t m_firstLoopTime = 0;
+static uint32_t m_lastLoopTime = 0;
+static USB_JoystickReport_Input_t m_lastReport;
+
+// EEMEM variables, see sim/include/avr/eeprom.h
+extern uint8_t __start_sim_eeprom[] __attribute__((weak));
+extern uint8_t __stop_sim_eeprom[] __attribute__((weak));
+
+static const char* const m_buttonNames[] = {
+	"Y", "B", "A", "X", "L", "R", "ZL", "ZR",
+	"MINUS", "PLUS", "LCLICK", "RCLICK", "HOME", "CAPTURE", "14", "15"
+};
+
+static const char* const m_hatNames[] = {
+	"UP", "UP_RIGHT", "RIGHT", "DOWN_RIGHT", "DOWN", "DOWN_LEFT", "LEFT", "UP_LEFT"
+};
+
+static void Sim_EEPROM(bool save) {
+	size_t size = __stop_sim_eeprom - __start_sim_eeprom;
+	if (!m_eepromFile || !size)
+		return;
+
+	FILE* file = fopen(m_eepromFile, save ? "wb" : "rb");
+	if (!file)
+		return;
+
+	if (save)
+	{
+		fwrite(__start_sim_eeprom, 1, size, file);
+	}
+	else if (fread(__start_sim_eeprom, 1, size, file) != size)
+	{
+		memset(__start_sim_eeprom, 0xFF, size);
+	}
+	fclose(file);
+}
+
+static void Sim_Exit(void) {
+	Sim_EEPROM(true);
+	fflush(stdout);
+	fprintf(stderr, "%u.%03u s simulated, %u reports (%u changes, %u NAKs), %u sequences, %u loops\n",
+		m_now / 1000, m_now % 1000, m_reports, m_changes, m_naks, m_sequences, m_loops);
+	if (m_loops > 1)
+	{
+		// Loops are timed from the first one, so the setup sequence isn't counted
+		double loopMS = (double)(m_lastLoopTime - m_firstLoopTime) / (m_loops - 1);
+		fprintf(stderr, "%.3f s/loop, %.1f loops/hour\n", loopMS / 1000, 3600000.0 / loopMS);
+	}
+	exit(0);
+}
+
+static void Sim_Trace(const USB_JoystickReport_Input_t* report) {
+	bool changed = (m_reports == 0) || memcmp(report, &m_lastReport, sizeof(USB_JoystickReport_Input_t));
+	m_reports++;
+	if (changed)
+	{
+		m_changes++;
+		m_lastReport = *report;
+	}
+	if (m_quiet || (m_changesOnly && !changed))
+		return;
+
+	printf("%u ", m_now);
+	if (report->Button)
+	{
+		const char* separator = "";
+		for (uint8_t i = 0; i < 16; i++)
+		{
+			if (report->Button & (1 << i))
+			{
+				printf("%s%s", separator, m_buttonNames[i]);
+				separator = "+";
+			}
+		}
+	}
+	else
+	{
+		printf("-");
+	}
+	printf(" %s %u %u %u %u\n",
+		report->HAT < 8 ? m_hatNames[report->HAT] : "-",
+		report->LX, report->LY, report->RX, report->RY);
+}
+
+int main(int argc, char* argv[]) {
+	int option;
+	while ((option = getopt(argc, argv, "t:l:p:cqe:")) != -1)
+	{
+		switch (option)
+		{
+			case 't': m_endTime = strtoul(optarg, NULL, 10) * 1000; break;
+			case 'l': m_maxLoops = strtoul(optarg, NULL, 10); break;
+			case 'p': m_pollInterval = strtoul(optarg, NULL, 10); break;
+			case 'c': m_changesOnly = true; break;
+			case 'q': m_quiet = true; break;
+			case 'e': m_eepromFile = optarg; break;
+			default:
+				fprintf(stderr, "Usage: %s [-t seconds] [-l loops] [-p poll_ms] [-c] [-q] [-e eeprom_file]\n", argv[0]);
+				return 1;
+		}
+	}
+	if (m_pollInterval == 0)
+	{
+		m_pollInterval = 1;
+	}
+
+	// A blank EEPROM reads as 0xFF
+	memset(__start_sim_eeprom, 0xFF, __stop_sim_eeprom - __start_sim_eeprom);
+	Sim_EEPROM(false);
+
+	return Firmware_main();
+}
+
+// The host enumerates the device, then polls the IN endpoint once per interval.
+// Called once per main loop iteration, by which time the next report is in the bank.
+void USB_USBTask(void) {
+	if (USB_DeviceState != DEVICE_STATE_Configured)
+	{
+		USB_DeviceState = DEVICE_STATE_Configured;
+		EVENT_USB_Device_ConfigurationChanged();
+		return;
+	}
+
+	m_now += m_pollInterval;
+	if (m_inBankFull)
+	{
+		Sim_Trace(&m_inBank);
+		m_inBankFull = false;
+	}
+	else
+	{
+		m_naks++;
+	}
+
+	if (m_now >= m_endTime)
+	{
+		Sim_Exit();
+	}
+}
+
+void USB_Init(void) {
+	USB_DeviceState = DEVICE_STATE_Powered;
+}
+
+uint16_t USB_Device_GetFrameNumber(void) {
+	return m_now & 0x7FF;
+}
+
+void USB_Device_EnableSOFEvents(void) {
+}
+
+bool Endpoint_ConfigureEndpoint(uint8_t Address, uint8_t Type, uint16_t Size, uint8_t Banks) {
+	return true;
+}
+
+void Endpoint_SelectEndpoint(uint8_t Address) {
+	m_selectedEndpoint = Address;
+}
+
+uint8_t Endpoint_GetCurrentEndpoint(void) {
+	return m_selectedEndpoint;
+}
+
+bool Endpoint_IsOUTReceived(void) {
+	return false;
+}
+
+bool Endpoint_IsINReady(void) {
+	return !m_inBankFull;
+}
+
+void Endpoint_ClearOUT(void) {
+}
+
+void Endpoint_ClearIN(void) {
+	if (m_selectedEndpoint == JOYSTICK_IN_EPADDR)
+	{
+		m_inBankFull = true;
+	}
+}
+
+uint8_t Endpoint_Write_Stream_LE(const void* Buffer, uint16_t Length, uint16_t* BytesProcessed) {
+	if (m_selectedEndpoint == JOYSTICK_IN_EPADDR)
+	{
+		memcpy(&m_inBank, Buffer, Length < sizeof(m_inBank) ? Length : sizeof(m_inBank));
+	}
+	return 0;
+}
+
+uint8_t eeprom_read_byte(const uint8_t* address) {
+	return *address;
+}
+
+void eeprom_update_byte(uint8_t* address, uint8_t value) {
+	*address = value;
+}
+
+uint16_t eeprom_read_word(const uint16_t* address) {
+	return *address;
+}
+
+void eeprom_update_word(uint16_t* address, uint16_t value) {
+	*address = value;
+}
+
+void eeprom_read_block(void* dest, const void* src, size_t n) {
+	memcpy(dest, src, n);
+}
+
+void eeprom_update_block(const void* src, void* dest, size_t n) {
+	memcpy(dest, src, n);
+}
+
+// The telemetry events are traced instead of sent over the USART
+void Telemetry_Init(void) {
+}
+
+void Telemetry_Task(void) {
+}
+
+void Telemetry_Sequence(int start, int end) {
+	m_sequences++;
+	if (!m_quiet)
+	{
+		printf("# %u sequence [%d,%d]\n", m_now, start, end);
+	}
+}
+
+void Telemetry_Loop(void) {
+	if (m_loops++ == 0)
+	{
+		m_firstLoopTime = m_now;
+	}
+	m_lastLoopTime = m_now;
+	if (!m_quiet)
+	{
+		printf("# %u loop %u\n", m_now, m_loops);
+	}
+	if (m_loops == m_maxLoops)
+	{
+		Sim_Exit();
+	}
+}
@@ -0,0 +1 @@
+// Simulator stand-in for <LUFA/Drivers/Board/Joystick.h>: no board drivers are used.
@@ -0,0 +1,62 @@
+/*
+Simulator stand-in for <LUFA/Drivers/USB/USB.h>: the part of LUFA's device
+API used by Joystick.c, implemented by sim/Sim.c against a simulated host.
+*/
+
+#ifndef _SIM_LUFA_USB_H_
+#define _SIM_LUFA_USB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define ATTR_WARN_UNUSED_RESULT __attribute__((warn_unused_result))
+#define ATTR_NON_NULL_PTR_ARG(...) __attribute__((nonnull(__VA_ARGS__)))
+
+#define ENDPOINT_DIR_IN  0x80
+#define ENDPOINT_DIR_OUT 0x00
+#define EP_TYPE_INTERRUPT 0x03
+
+enum USB_Device_States_t
+{
+	DEVICE_STATE_Unattached = 0,
+	DEVICE_STATE_Powered    = 1,
+	DEVICE_STATE_Default    = 2,
+	DEVICE_STATE_Addressed  = 3,
+	DEVICE_STATE_Configured = 4,
+	DEVICE_STATE_Suspended  = 5,
+};
+
+extern volatile uint8_t USB_DeviceState;
+
+// Descriptor types, only referenced by Descriptors.h
+typedef struct { uint8_t Size; } USB_Descriptor_Configuration_Header_t;
+typedef struct { uint8_t Size; } USB_Descriptor_Interface_t;
+typedef struct { uint8_t Size; } USB_HID_Descriptor_HID_t;
+typedef struct { uint8_t Size; } USB_Descriptor_Endpoint_t;
+
+typedef uint8_t uint_reg_t;
+
+void USB_Init(void);
+void USB_USBTask(void);
+uint16_t USB_Device_GetFrameNumber(void);
+void USB_Device_EnableSOFEvents(void);
+
+bool Endpoint_ConfigureEndpoint(uint8_t Address, uint8_t Type, uint16_t Size, uint8_t Banks);
+void Endpoint_SelectEndpoint(uint8_t Address);
+uint8_t Endpoint_GetCurrentEndpoint(void);
+bool Endpoint_IsOUTReceived(void);
+bool Endpoint_IsINReady(void);
+void Endpoint_ClearOUT(void);
+void Endpoint_ClearIN(void);
+uint8_t Endpoint_Write_Stream_LE(const void* Buffer, uint16_t Length, uint16_t* BytesProcessed);
+
+#define GlobalInterruptEnable()
+#define GlobalInterruptDisable()
+#define GetGlobalInterruptMask() ((uint_reg_t)0)
+#define SetGlobalInterruptMask(mask) ((void)(mask))
+
+// Events implemented by Joystick.c
+void EVENT_USB_Device_ConfigurationChanged(void);
+
+#endif
@@ -0,0 +1 @@
+// Simulator stand-in for <LUFA/Platform/Platform.h>
@@ -0,0 +1,20 @@
+// Simulator stand-in for <avr/eeprom.h>: EEMEM variables live in host memory,
+// erased (0xFF) when the simulator starts, and writes complete immediately.
+#ifndef _SIM_AVR_EEPROM_H_
+#define _SIM_AVR_EEPROM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define EEMEM __attribute__((section("sim_eeprom")))
+
+#define eeprom_is_ready() 1
+
+uint8_t eeprom_read_byte(const uint8_t* address);
+void eeprom_update_byte(uint8_t* address, uint8_t value);
+uint16_t eeprom_read_word(const uint16_t* address);
+void eeprom_update_word(uint16_t* address, uint16_t value);
+void eeprom_read_block(void* dest, const void* src, size_t n);
+void eeprom_update_block(const void* src, void* dest, size_t n);
+
+#endif
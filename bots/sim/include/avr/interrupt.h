@@ -0,0 +1,9 @@
+// Simulator stand-in for <avr/interrupt.h>: the simulator has no interrupts.
+#ifndef _SIM_AVR_INTERRUPT_H_
+#define _SIM_AVR_INTERRUPT_H_
+
+#define sei()
+#define cli()
+#define ISR(vector) static void vector(void)
+
+#endif
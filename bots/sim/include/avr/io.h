@@ -0,0 +1,25 @@
+// Simulator stand-in for <avr/io.h>: only the registers the bots touch.
+#ifndef _SIM_AVR_IO_H_
+#define _SIM_AVR_IO_H_
+
+#include <stdint.h>
+
+extern volatile uint8_t MCUSR;
+extern volatile uint8_t DDRB, PORTB, PINB;
+extern volatile uint8_t DDRD, PORTD, PIND;
+extern volatile uint8_t TCCR0A, TCCR0B, TCNT0;
+
+#define _BV(bit) (1 << (bit))
+
+#define WDRF 3
+#define CS00 0
+#define PB0  0
+#define PB1  1
+#define PB2  2
+#define PB3  3
+#define PB4  4
+#define PB5  5
+#define PB6  6
+#define PB7  7
+
+#endif
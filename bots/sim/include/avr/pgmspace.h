@@ -0,0 +1,17 @@
+// Simulator stand-in for <avr/pgmspace.h>: program memory is ordinary memory on the host.
+#ifndef _SIM_AVR_PGMSPACE_H_
+#define _SIM_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+
+#define memcpy_P(dest, src, n) memcpy((dest), (src), (n))
+#define pgm_read_byte(address)  (*(const uint8_t*)(address))
+#define pgm_read_word(address)  (*(const uint16_t*)(address))
+#define pgm_read_dword(address) (*(const uint32_t*)(address))
+#define pgm_read_ptr(address)   (*(const void* const*)(address))
+
+#endif
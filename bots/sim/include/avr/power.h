@@ -0,0 +1,7 @@
+// Simulator stand-in for <avr/power.h>
+#ifndef _SIM_AVR_POWER_H_
+#define _SIM_AVR_POWER_H_
+
+#define clock_prescale_set(x)
+
+#endif
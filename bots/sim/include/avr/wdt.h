@@ -0,0 +1,8 @@
+// Simulator stand-in for <avr/wdt.h>
+#ifndef _SIM_AVR_WDT_H_
+#define _SIM_AVR_WDT_H_
+
+#define wdt_disable()
+#define wdt_reset()
+
+#endif
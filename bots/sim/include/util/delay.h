@@ -0,0 +1,8 @@
+// Simulator stand-in for <util/delay.h>: busy waits take no simulated time.
+#ifndef _SIM_UTIL_DELAY_H_
+#define _SIM_UTIL_DELAY_H_
+
+#define _delay_ms(ms)
+#define _delay_us(us)
+
+#endif
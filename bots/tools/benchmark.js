@@ -0,0 +1,190 @@
+// Times one loop of every bot in the native simulator (see sim/) and reports
+// the resulting throughput, compared against the results in benchmark.json.
+//
+// Usage:
+//   node tools/benchmark.js            compare against benchmark.json
+//   node tools/benchmark.js --update   also store the new results
+//   node tools/benchmark.js AutoHost   only run the cases of these bots
+
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { execSync } = require('child_process');
+
+const BOTS = path.join(__dirname, '..');
+const RESULTS = path.join(__dirname, 'benchmark.json');
+
+// Loops timed per case, after the first one
+const LOOPS = 10;
+// Longest simulated run per case, in seconds
+const MAX_TIME = 7 * 24 * 3600;
+
+// One loop is whatever the bot reports with Telemetry_Loop and yields perLoop
+// units. config overrides values of the bot's Config.h, timeScale builds it
+// with its waits scaled (see Common/Timing.h).
+const cases = [
+  { target: 'AutoBattleTower', unit: 'battles' },
+  { target: 'AutoFossil', unit: 'fossils' },
+  { target: 'AutoHost', unit: 'raids' },
+  {
+    name: 'AutoHost (link code)',
+    target: 'AutoHost',
+    config: { m_useLinkCode: 'true' },
+    unit: 'raids',
+  },
+  {
+    name: 'AutoHost (reroll)',
+    target: 'AutoHost',
+    config: { m_skip3Days: 'true', m_unsafeDC: 'true' },
+    unit: 'raids',
+  },
+  {
+    name: 'AutoHost (fast console)',
+    target: 'AutoHost',
+    timeScale: 'TIMING_FAST',
+    unit: 'raids',
+  },
+  { target: 'AutoLoto', unit: 'loto draws' },
+  { target: 'AutoRoller', unit: 'den rolls' },
+  { target: 'AutoTournament', unit: 'tournament steps' },
+  { target: 'BerryFarmer', unit: 'berry shakes' },
+  { target: 'BoxRelease', unit: 'Pokemon released' },
+  { target: 'BoxSurpriseTrade', unit: 'trades' },
+  { target: 'DaySkipper', unit: 'days skipped' },
+  {
+    name: 'DaySkipper (JP)',
+    target: 'DaySkipper',
+    config: { m_JP_EU_US: '0' },
+    unit: 'days skipped',
+  },
+  { target: 'DaySkipper_Unlimited', unit: 'days skipped' },
+  { target: 'EggCollector', unit: 'egg attempts' },
+  ...[0, 3, 7].map((group) => ({
+    name: `EggHatcher (${(group + 1) * 1280} steps)`,
+    target: 'EggHatcher',
+    config: { m_eggSteps: `${(group + 1) * 1280}` },
+    unit: 'eggs',
+    perLoop: 5,
+  })),
+  {
+    target: 'FriendDeleteAdd',
+    config: { m_deleteCount: '50' },
+    unit: 'friends deleted',
+  },
+  { target: 'GodEggDuplication', unit: 'duplications' },
+  { target: 'HomeReleaser', unit: 'boxes released' },
+  { target: 'InfiniteHatcher', unit: 'eggs' },
+  {
+    name: 'InfiniteHatcher (2560 steps)',
+    target: 'InfiniteHatcher',
+    config: { m_eggSteps: '2560' },
+    unit: 'eggs',
+  },
+  { target: 'PurpleBeam', unit: 'resets' },
+  { target: 'ShinyFiveRegi', unit: 'encounters' },
+  { target: 'ShinySwordTrio', unit: 'encounters' },
+  { target: 'TurboA', unit: 'presses' },
+  { target: 'WattFarmer', unit: 'watt collections' },
+  { target: 'WattBerryFarmer', unit: 'watt and berry collections' },
+];
+
+// Copy what the simulator needs, like the hex service does for a build
+function prepare(dir, { target, config = {} }) {
+  const files = ['Joystick.h', 'Joystick.c', 'Config', 'Common', target];
+  for (const file of files) {
+    fs.cpSync(path.join(BOTS, file), path.join(dir, file), { recursive: true });
+  }
+  fs.cpSync(path.join(BOTS, 'sim'), path.join(dir, 'sim'), {
+    recursive: true,
+    filter: (src) => path.basename(src) !== 'build',
+  });
+
+  if (!Object.keys(config).length) return;
+
+  const configPath = path.join(dir, target, 'Config.h');
+  let configStr = fs.readFileSync(configPath, 'utf8');
+  for (const [key, value] of Object.entries(config)) {
+    const pattern = new RegExp(`(\\b${key}\\s*=\\s*)[^;]+`);
+    if (!pattern.test(configStr)) {
+      throw new Error(`${target}/Config.h has no ${key}`);
+    }
+    configStr = configStr.replace(pattern, `$1${value}`);
+  }
+  fs.writeFileSync(configPath, configStr);
+}
+
+function run(benchCase) {
+  const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'benchmark-'));
+  try {
+    prepare(dir, benchCase);
+    const timeScale = benchCase.timeScale || 'TIMING_STOCK';
+    execSync(`make -s -C sim TARGET=${benchCase.target} TIME_SCALE=${timeScale}`, {
+      cwd: dir,
+      stdio: 'pipe',
+    });
+    // The summary goes to stderr
+    const summary = execSync(
+      `./sim/build/${benchCase.target} -q -l ${LOOPS + 1} -t ${MAX_TIME} 2>&1`,
+      { cwd: dir, encoding: 'utf8' },
+    );
+    const match = summary.match(/([\d.]+) s\/loop/);
+    return match ? parseFloat(match[1]) : null;
+  } finally {
+    fs.rmSync(dir, { recursive: true, force: true });
+  }
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  const update = args.includes('--update');
+  const targets = args.filter((arg) => !arg.startsWith('--'));
+  const previous = fs.existsSync(RESULTS)
+    ? JSON.parse(fs.readFileSync(RESULTS, 'utf8'))
+    : {};
+  const results = { ...previous };
+
+  console.log(
+    `${'Case'.padEnd(28)}${'s/loop'.padStart(10)}${'per hour'.padStart(
+      12,
+    )}  unit`,
+  );
+  for (const benchCase of cases) {
+    if (targets.length && !targets.includes(benchCase.target)) continue;
+
+    const name = benchCase.name || benchCase.target;
+    const loopSeconds = run(benchCase);
+    if (loopSeconds === null) {
+      console.log(`${name.padEnd(28)}${'-'.padStart(10)}  (not enough loops)`);
+      continue;
+    }
+
+    const perHour = (3600 / loopSeconds) * (benchCase.perLoop || 1);
+    let change = '';
+    if (previous[name]) {
+      const delta =
+        ((loopSeconds - previous[name].loopSeconds) /
+          previous[name].loopSeconds) *
+        100;
+      if (Math.abs(delta) >= 0.05) {
+        change = `  (${delta > 0 ? '+' : ''}${delta.toFixed(1)}% loop time)`;
+      }
+    }
+    console.log(
+      `${name.padEnd(28)}${loopSeconds.toFixed(3).padStart(10)}${perHour
+        .toFixed(1)
+        .padStart(12)}  ${benchCase.unit}${change}`,
+    );
+
+    results[name] = {
+      loopSeconds,
+      perHour: Math.round(perHour * 10) / 10,
+      unit: benchCase.unit,
+    };
+  }
+
+  if (update) {
+    fs.writeFileSync(RESULTS, `${JSON.stringify(results, null, 2)}\n`);
+  }
+}
+
+main();
@@ -0,0 +1,50 @@
+#!/bin/sh
+# Builds every bot with BENCH=Y for each MCU, runs it in simavr and prints
+# the cycles spent per poll (see Common/Benchmark.h) with its memory usage.
+#
+# Usage: tools/simavr_bench.sh [MCU...]    (default: atmega16u2 atmega32u4)
+# Needs avr-gcc, avr-size and simavr in the PATH.
+
+cd "$(dirname "$0")/.." || exit 1
+
+MCUS=${*:-atmega16u2 atmega32u4}
+# Cycles available per poll at 16 MHz with the default 5 ms polling interval
+BUDGET=80000
+
+printf '%-22s %-11s %14s %14s %14s %6s %6s %6s %6s\n' \
+	bot mcu report_worst report_avg loop_avg busy text data bss stack
+for mcu in $MCUS; do
+	for dir in */; do
+		bot=${dir%/}
+		[ -f "$bot/$bot.c" ] || continue
+
+		make clean TARGET="$bot" > /dev/null 2>&1
+		if ! make BENCH=Y TARGET="$bot" MCU="$mcu" > /dev/null 2>&1; then
+			printf '%-22s %-11s build failed\n' "$bot" "$mcu"
+			continue
+		fi
+
+		out=$(timeout 120 simavr -f 16000000 -m "$mcu" "$bot.elf" 2>&1 | grep 'BENCH')
+		field() {
+			echo "$out" | sed -n "s/.*BENCH $1 .*$2=\([0-9]*\).*/\1/p"
+		}
+		report_worst=$(field report worst)
+		report_avg=$(field report avg)
+		loop_avg=$(field loop avg)
+		stack=$(field stack used)
+		busy=-
+		if [ -n "$loop_avg" ]; then
+			busy=$(awk "BEGIN { printf \"%.2f%%\", $loop_avg * 100 / $BUDGET }")
+		fi
+
+		# Flash is .text + .data, SRAM is .data + .bss + stack
+		size() {
+			avr-size -A "$bot.elf" | awk -v section="$1" '$1 == section { print $2 }'
+		}
+
+		printf '%-22s %-11s %14s %14s %14s %6s %6s %6s %6s\n' \
+			"$bot" "$mcu" "${report_worst:--}" "${report_avg:--}" "${loop_avg:--}" "$busy" \
+			"$(size .text)" "$(size .data)" "$(size .bss)" "${stack:--}"
+	done
+done
+make clean > /dev/null 2>&1
@@ -0,0 +1,135 @@
+// Builds every bot for every MCU and reports where its flash and SRAM go,
+// flagging the combinations that don't fit (see mcuBudgets in
+// utils/constants.js). The sizes are stored in sizes.json, which the hex
+// service reads to refuse configurations that wouldn't fit before building.
+//
+// Usage:
+//   node tools/size_report.js [--stack=<bytes>] [--no-update] [MCU...]
+// Exits with 1 if any combination is over budget.
+
+const fs = require('fs');
+const path = require('path');
+const { execSync } = require('child_process');
+const { mcuBudgets, stackReserve } = require('../../utils/constants');
+
+const BOTS = path.join(__dirname, '..');
+const SIZES = path.join(__dirname, 'sizes.json');
+
+// Input sections of the link map, the line wraps after long section names:
+//  .text.USB_Init
+//                 0x00000000000004a2       0x1e LUFA/Drivers/USB/Core/...o
+const INPUT_SECTION = /^ (\.\S+|COMMON)\s+0x[0-9a-f]+\s+0x([0-9a-f]+)\s+(\S+\.o)$/gm;
+
+function sectionKind(name) {
+  if (name.startsWith('.progmem')) return 'progmem';
+  if (name.startsWith('.text')) return 'text';
+  if (name.startsWith('.data') || name.startsWith('.rodata')) return 'data';
+  if (name.startsWith('.bss') || name === 'COMMON') return 'bss';
+  return null;
+}
+
+function elfSizes(target) {
+  const sizes = {};
+  const output = execSync(`avr-size -A ${target}.elf`, {
+    cwd: BOTS,
+    encoding: 'utf8',
+  });
+  for (const line of output.split('\n')) {
+    const [name, size] = line.trim().split(/\s+/);
+    if (['.text', '.data', '.bss'].includes(name)) {
+      sizes[name.slice(1)] = parseInt(size, 10);
+    }
+  }
+  return sizes;
+}
+
+// PROGMEM tables and LUFA's share of the code, from the link map
+function mapSizes(target) {
+  const map = fs.readFileSync(path.join(BOTS, `${target}.map`), 'utf8');
+  const start = map.indexOf('Linker script and memory map');
+  const text = map.slice(start).replace(/^( \S+)\n\s+(?=0x)/gm, '$1 ');
+
+  const sizes = { progmem: 0, lufa: 0 };
+  for (const [, name, size, object] of text.matchAll(INPUT_SECTION)) {
+    const kind = sectionKind(name);
+    const bytes = parseInt(size, 16);
+    if (kind === 'progmem') {
+      sizes.progmem += bytes;
+    }
+    if (kind === 'text' && object.includes('LUFA/')) {
+      sizes.lufa += bytes;
+    }
+  }
+  return sizes;
+}
+
+function build(target, mcu) {
+  execSync(`make clean TARGET=${target} && make TARGET=${target} MCU=${mcu}`, {
+    cwd: BOTS,
+    stdio: 'pipe',
+  });
+  const sizes = { ...elfSizes(target), ...mapSizes(target) };
+  // .data is stored in flash and copied to SRAM at boot
+  sizes.flash = sizes.text + sizes.data;
+  sizes.sram = sizes.data + sizes.bss;
+  return sizes;
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  const stackArg = args.find((arg) => arg.startsWith('--stack='));
+  const stack = stackArg ? parseInt(stackArg.split('=')[1], 10) : stackReserve;
+  const update = !args.includes('--no-update');
+  const mcus = args.filter((arg) => !arg.startsWith('--'));
+
+  const targets = fs
+    .readdirSync(BOTS)
+    .filter((dir) => fs.existsSync(path.join(BOTS, dir, `${dir}.c`)));
+  const results = fs.existsSync(SIZES)
+    ? JSON.parse(fs.readFileSync(SIZES, 'utf8'))
+    : {};
+  let overBudget = 0;
+
+  const columns = ['text', 'data', 'bss', 'progmem', 'lufa', 'flash', 'sram'];
+  console.log(
+    `${'Bot'.padEnd(22)}${'MCU'.padEnd(13)}${columns
+      .map((column) => column.padStart(8))
+      .join('')}`,
+  );
+  for (const mcu of mcus.length ? mcus : Object.keys(mcuBudgets)) {
+    const budget = mcuBudgets[mcu];
+    for (const target of targets) {
+      let sizes;
+      try {
+        sizes = build(target, mcu);
+      } catch (e) {
+        console.log(`${target.padEnd(22)}${mcu.padEnd(13)}  build failed`);
+        overBudget++;
+        continue;
+      }
+
+      const flags = [];
+      if (sizes.flash > budget.flash) {
+        flags.push(`flash over by ${sizes.flash - budget.flash}`);
+      }
+      if (sizes.sram > budget.sram - stack) {
+        flags.push(`SRAM over by ${sizes.sram - (budget.sram - stack)}`);
+      }
+      if (flags.length) overBudget++;
+
+      const row = columns.map((column) => `${sizes[column]}`.padStart(8));
+      const flag = flags.length ? `  OVER BUDGET: ${flags.join(', ')}` : '';
+      console.log(`${target.padEnd(22)}${mcu.padEnd(13)}${row.join('')}${flag}`);
+
+      results[target] = { ...results[target], [mcu]: sizes };
+    }
+  }
+  execSync('make clean', { cwd: BOTS, stdio: 'pipe' });
+
+  if (update) {
+    fs.writeFileSync(SIZES, `${JSON.stringify(results, null, 2)}\n`);
+  }
+  process.exit(overBudget ? 1 : 0);
+}
+
+main();
@@ -0,0 +1,108 @@
+// Decodes the telemetry records sent by bots built with TELEMETRY=Y
+// (see Common/Telemetry.h) and prints them along with loops per hour.
+//
+// Usage:
+//   stty -F /dev/ttyUSB0 115200 raw -echo
+//   node tools/telemetry.js /dev/ttyUSB0
+// or pipe a capture in: node tools/telemetry.js < capture.bin
+
+const fs = require('fs');
+
+const SYNC = 0xa5;
+const TLM_SEQUENCE = 0x01;
+const TLM_LOOP = 0x02;
+const TLM_STATUS = 0x03;
+
+const payloadLength = {
+  [TLM_SEQUENCE]: 8,
+  [TLM_LOOP]: 8,
+  [TLM_STATUS]: 7,
+};
+
+// Same as avr-libc's _crc8_ccitt_update
+function crc8(crc, data) {
+  crc ^= data;
+  for (let i = 0; i < 8; i++) {
+    crc = crc & 0x80 ? ((crc << 1) ^ 0x07) & 0xff : (crc << 1) & 0xff;
+  }
+  return crc;
+}
+
+function formatTime(ms) {
+  const seconds = Math.floor(ms / 1000);
+  const h = Math.floor(seconds / 3600);
+  const m = Math.floor((seconds % 3600) / 60);
+  const s = seconds % 60;
+  return `${h}:${String(m).padStart(2, '0')}:${String(s).padStart(2, '0')}`;
+}
+
+let firstLoop = null;
+let pending = Buffer.alloc(0);
+
+function handleRecord(type, payload) {
+  const uptime = payload.readUInt32LE(0);
+  const time = formatTime(uptime);
+
+  if (type === TLM_SEQUENCE) {
+    const start = payload.readUInt16LE(4);
+    const end = payload.readUInt16LE(6);
+    console.log(`${time} sequence [${start},${end}]`);
+  } else if (type === TLM_LOOP) {
+    const loops = payload.readUInt32LE(4);
+    if (!firstLoop) {
+      firstLoop = { uptime, loops };
+    }
+    let rate = '';
+    if (uptime > firstLoop.uptime) {
+      const perHour =
+        ((loops - firstLoop.loops) * 3600000) / (uptime - firstLoop.uptime);
+      rate = ` (${perHour.toFixed(1)} loops/hour)`;
+    }
+    console.log(`${time} loop ${loops}${rate}`);
+  } else if (type === TLM_STATUS) {
+    const cadence = payload.readUInt16LE(4) / 64;
+    const dropped = payload.readUInt8(6);
+    console.log(
+      `${time} status: ${cadence.toFixed(2)} ms/poll, ${dropped} records dropped`,
+    );
+  }
+}
+
+function decode(chunk) {
+  pending = Buffer.concat([pending, chunk]);
+  let i = 0;
+  while (i < pending.length) {
+    if (pending[i] !== SYNC) {
+      i++;
+      continue;
+    }
+    if (i + 2 > pending.length) break;
+
+    const type = pending[i + 1];
+    const length = payloadLength[type];
+    if (length === undefined) {
+      i++;
+      continue;
+    }
+    if (i + 3 + length > pending.length) break;
+
+    let crc = crc8(0, type);
+    for (let j = 0; j < length; j++) {
+      crc = crc8(crc, pending[i + 2 + j]);
+    }
+    if (crc !== pending[i + 2 + length]) {
+      // Not a record boundary, resync on the next byte
+      i++;
+      continue;
+    }
+
+    handleRecord(type, pending.slice(i + 2, i + 2 + length));
+    i += 3 + length;
+  }
+  pending = pending.slice(i);
+}
+
+const input = process.argv[2]
+  ? fs.createReadStream(process.argv[2])
+  : process.stdin;
+input.on('data', decode);
@@ -65,9 +65,10 @@ function App() {
   const [state, setState] = useState(botConfigs[0]);
   const [dateFormat, setDateFormat] = useState(2);
   const [mcu, setMcu] = useState('atmega16u2');
+  const [timing, setTiming] = useState('stock');
 
   function onSubmit() {
-    genHex(state.target, state.configFields, dateFormat, mcu);
+    genHex(state.target, state.configFields, dateFormat, mcu, timing);
   }
 
   return (
@@ -83,6 +84,8 @@ function App() {
             setDateFormat={setDateFormat}
             mcu={mcu}
             setMcu={setMcu}
+            timing={timing}
+            setTiming={setTiming}
           />
           <BotForm state={state} setState={setState} onSubmit={onSubmit} dateFormat={dateFormat} />
         </Box>
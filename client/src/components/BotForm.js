@@ -200,14 +200,22 @@ export default function BotForm({ state, setState, onSubmit, dateFormat }) {
                     state.target === 'InfiniteHatcher' &&
                     f.param === 'm_boxesToFill'
                   ) {
-                    totalSeconds =
-                      f.value *
-                      (infiniteHatcherTimes[
-                        state.configFields.find(
-                          (f) => f.param === 'm_eggStepGroup',
-                        ).value - 1
-                      ] *
-                        60);
+                    const steps = state.configFields.find(
+                      (f) => f.param === 'm_eggSteps',
+                    ).value;
+                    const flameBody =
+                      state.configFields.find((f) => f.param === 'm_flameBody')
+                        .value === 'true';
+                    // Egg step group, as EggSteps_Group in EggSteps.h
+                    const groups =
+                      Math.ceil(steps / 1280) * (flameBody ? 1 : 2);
+                    const group = groups ? groups - 1 : 0;
+                    // The times start at group 1
+                    const index = Math.min(
+                      Math.max(group - 1, 0),
+                      infiniteHatcherTimes.length - 1,
+                    );
+                    totalSeconds = f.value * (infiniteHatcherTimes[index] * 60);
                   } else if (
                     state.target === 'GodEggDuplication' &&
                     f.param === 'm_maxCycle'
@@ -370,6 +378,7 @@ export default function BotForm({ state, setState, onSubmit, dateFormat }) {
                       'AutoLoto',
                       'BerryFarmer',
                       'WattFarmer',
+                      'WattBerryFarmer',
                     ].includes(state.target)
                       ? 'between'
                       : 'end'
@@ -426,6 +435,18 @@ export default function BotForm({ state, setState, onSubmit, dateFormat }) {
                       <Text size="small">8 seconds</Text>
                     </Box>
                   )}
+                  {state.target === 'WattBerryFarmer' && (
+                    <Box direction="row" align="center">
+                      <Text
+                        size="small"
+                        weight="bold"
+                        margin={{ right: '5px' }}
+                      >
+                        Approx. Time per Collect:
+                      </Text>
+                      <Text size="small">13 seconds</Text>
+                    </Box>
+                  )}
                   <Button
                     type="submit"
                     primary
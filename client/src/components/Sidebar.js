@@ -1,9 +1,9 @@
 import React from 'react';
 import { Box, List, Select, Text } from 'grommet';
 
-import { dateFormatOptions, mcuOptions } from '../utils/constants';
+import { dateFormatOptions, mcuOptions, timingOptions } from '../utils/constants';
 
-export default function Sidebar({ botConfigs, state, setState, dateFormat, setDateFormat, mcu, setMcu }) {
+export default function Sidebar({ botConfigs, state, setState, dateFormat, setDateFormat, mcu, setMcu, timing, setTiming }) {
   return (
     <Box
       direction="column"
@@ -25,6 +25,18 @@ export default function Sidebar({ botConfigs, state, setState, dateFormat, setDa
           />
         </Box>
       </Box>
+      <Box direction="row" align="center" pad={{ top: '5px', bottom: '5px' }} flex={{ shrink: 0 }}>
+        <Text margin={{ right: '10px' }}>Console:</Text>
+        <Box width="small">
+          <Select
+            size="xsmall"
+            options={timingOptions}
+            value={timingOptions.find((o) => o.value === timing)}
+            onChange={({ option }) => setTiming(option.value)}
+            labelKey="name"
+          />
+        </Box>
+      </Box>
       <Box direction="row" align="center" pad={{ top: '5px', bottom: '40px' }} flex={{ shrink: 0 }}>
         <Text margin={{ right: '10px' }}>Date Format:</Text>
         <Box width="xsmall">
@@ -1,6 +1,6 @@
 import axios from 'axios';
 
-export function genHex(target, configFields, dateFormat, mcu) {
+export function genHex(target, configFields, dateFormat, mcu, timing) {
   const configParams = configFields.reduce((acc, f) => {
     const { param, value } = f;
     return { ...acc, [param]: value };
@@ -9,6 +9,7 @@ export function genHex(target, configFields, dateFormat, mcu) {
     params: {
       target,
       mcu,
+      timing,
       ...configParams,
       m_JP_EU_US: dateFormat,
     },
@@ -254,16 +254,16 @@ export const botConfigs = [
       'First, the bot will sync and unsync the system time to reset to current date',
       'Next, it will skip one frame forward',
       'Then it will shake the berry tree only once',
-      'It will save after the number of attempts specified here',
+      'It will save as rarely as it can without a crash losing more than the minutes of farming set here',
     ],
     configFields: [
       {
-        param: 'm_saveAt',
-        name: 'Save After Attempts',
+        param: 'm_maxLossMinutes',
+        name: 'Most Minutes Lost to a Crash',
         description:
-          'To prevent loss of berries if the game crashes, set a number of times you would like to collect before saving.',
+          'The game can crash while skipping dates. The bot measures how long a collection and a save take, and saves as rarely as it can without a crash losing more than this many minutes of farming.',
         type: 'number',
-        value: 50,
+        value: 15,
       },
     ],
   },
@@ -290,6 +290,22 @@ export const botConfigs = [
         type: 'number',
         value: 2,
       },
+      {
+        param: 'm_lastBoxCount',
+        name: 'Pokemon in Last Box',
+        description:
+          'How many Pokemon the last box holds. The bot stops after them instead of going through the empty slots.',
+        type: 'number',
+        value: 30,
+      },
+      {
+        param: 'm_resumeProgress',
+        name: 'Resume After Power Loss',
+        description:
+          "If the bot is unplugged, it will continue from the box it was releasing when plugged back in with the cursor on that box's top-left slot. To start over, hold PB4 to ground while plugging in (PB4 is on the 16u2's 4 pin header (JP2) of the UNO R3 and is pin 8 of the Micro/Leonardo).",
+        type: 'bool',
+        value: 'true',
+      },
     ],
   },
   {
@@ -326,6 +342,14 @@ export const botConfigs = [
         type: 'bool',
         value: 'true',
       },
+      {
+        param: 'm_resumeProgress',
+        name: 'Resume After Power Loss',
+        description:
+          "If the bot is unplugged, it will continue from the last trade it saved when plugged back in over the box it was trading from. To start over, hold PB4 to ground while plugging in (PB4 is on the 16u2's 4 pin header (JP2) of the UNO R3 and is pin 8 of the Micro/Leonardo).",
+        type: 'bool',
+        value: 'true',
+      },
     ],
   },
   {
@@ -371,24 +395,50 @@ export const botConfigs = [
         type: 'number',
         value: 1000,
       },
+      {
+        param: 'm_resumeProgress',
+        name: 'Resume After Power Loss',
+        description:
+          "If the bot is unplugged, it will continue from the day it was skipping when plugged back in over the date selector. To start over, hold PB4 to ground while plugging in (PB4 is on the 16u2's 4 pin header (JP2) of the UNO R3 and is pin 8 of the Micro/Leonardo).",
+        type: 'bool',
+        value: 'true',
+      },
     ],
   },
   {
     name: 'Day Skipper (Unlimited)',
     target: 'DaySkipper_Unlimited',
     description:
-      "This bot advances frames automatically - useful for skipping to your shiny frame! Note that there are two versions of this bot. This one has no limit because it only ever advances the day - it knows not to count going from 31 -> 1 as a skip. The disadvantage is that you have no way of knowing its progress - if your skip is less than 22,280 frames, and you'd like to be able to monitor progress, use the regular Day Skipper instead.",
+      "This bot advances frames automatically - useful for skipping to your shiny frame! Note that there are two versions of this bot. This one has no limit because once it reaches December 31st, 2060, it goes back to January 2060 - it knows not to count that change as a skip. The disadvantage is that you have no way of knowing its progress - if your skip is less than 22,280 frames, and you'd like to be able to monitor progress, use the regular Day Skipper instead.",
     instructions: [
-      'Ensure that your system time is unsynced and set to the first day of any month with 31 days',
+      'Ensure that your system time is unsynced',
       'Go to a Pokemon Center to avoid crashing your game',
       'Activate the Y-Comm glitch',
       'Plug in the bot with your cursor over the date selector in the Date and Time Menu',
     ],
     botActions: [
-      'The bot will skip only days, knowing not to count the change from 31 -> 1',
+      'The bot will skip days, rolling the month and year over in the same date change at the end of each month',
       'Once finished, it will return to the game',
     ],
     configFields: [
+      {
+        param: 'm_day',
+        name: 'Current Switch Day',
+        type: 'number',
+        value: 1,
+      },
+      {
+        param: 'm_month',
+        name: 'Current Switch Month',
+        type: 'number',
+        value: 1,
+      },
+      {
+        param: 'm_year',
+        name: 'Current Switch Year',
+        type: 'number',
+        value: 2020,
+      },
       {
         param: 'm_dayToSkip',
         name: 'Number of Days to Skip',
@@ -433,7 +483,7 @@ export const botConfigs = [
       'This bot hatches columns of eggs from your boxes using the Rotom bike turbo boost for efficiency.',
     instructions: [
       'Ensure that your text speed is set to "Fast" and nicknames are set to "Don\'t Give"',
-      'Have only one Pokemon in your party, and that Pokemon must have the Flame Body ability',
+      'Have only one Pokemon in your party, ideally with the Flame Body ability',
       'Make sure that the Pokemon you are hatching is already registered in your Pokedex',
       'Make sure your Rotom bike is fully upgraded',
       'Go to the Route 5 nursery and charge up your Rotom bike boost',
@@ -451,46 +501,54 @@ export const botConfigs = [
     ],
     configFields: [
       {
-        param: 'm_eggStepGroup',
-        name: 'Egg Group Steps',
+        param: 'm_eggSteps',
+        name: 'Egg Steps',
         description:
-          "Use Serebii or Bulbapedia to figure out how many steps your Pokemon's Egg Group takes to hatch.",
+          "Use Serebii or Bulbapedia to figure out how many steps your Pokemon takes to hatch.",
         type: 'select',
         options: [
           {
             name: '1280 Steps',
-            value: 0,
+            value: 1280,
           },
           {
             name: '2560 Steps',
-            value: 1,
+            value: 2560,
           },
           {
             name: '3840 Steps',
-            value: 2,
+            value: 3840,
           },
           {
             name: '5120 Steps',
-            value: 3,
+            value: 5120,
           },
           {
             name: '6400 Steps',
-            value: 4,
+            value: 6400,
           },
           {
             name: '7680 Steps',
-            value: 5,
+            value: 7680,
           },
           {
             name: '8960 Steps',
-            value: 6,
+            value: 8960,
           },
           {
             name: '10240 Steps',
-            value: 7,
+            value: 10240,
           },
         ],
-        value: 3,
+        value: 5120,
+      },
+      {
+        param: 'm_flameBody',
+        name: 'Flame Body',
+        description:
+          'Whether your party Pokemon has Flame Body, Magma Armor or Steam Engine. Without one, the bot bikes twice as long.',
+        type: 'bool',
+        value: 'true',
       },
       {
         param: 'm_columnsOfEggs',
@@ -498,15 +556,31 @@ export const botConfigs = [
         type: 'number',
         value: 6,
       },
+      {
+        param: 'm_spinSpeed',
+        name: 'Spin Speed',
+        description:
+          'Leave at 0 to ride the small loops as a square, the way they were tuned. Otherwise the bot rides them as a circle, turning the stick by this many 1/256 of a turn per input (5 is a bit over one turn per loop).',
+        type: 'number',
+        value: 0,
+      },
+      {
+        param: 'm_resumeProgress',
+        name: 'Resume After Power Loss',
+        description:
+          "If the bot is unplugged, it will continue from the column it was hatching when plugged back in from the starting position. To start over, hold PB4 to ground while plugging in (PB4 is on the 16u2's 4 pin header (JP2) of the UNO R3 and is pin 8 of the Micro/Leonardo).",
+        type: 'bool',
+        value: 'true',
+      },
     ],
   },
   {
     name: 'Infinite Egg Hatcher (BETA)',
     target: 'InfiniteHatcher',
-    description: `This bot is significantly slower than the the Collector/Hatcher combo, but does not require two separate steps. It will continually collect eggs from the Bridge Field nursery and hatch them, filling boxes up to a specified maximum. Note that, similar to the Egg Collector bot, it is possible that an egg will not be collected every time, so some spots in your boxes may be skipped. For the best results, be sure to have the Oval Charm and have Pokemon with different trainer IDs in the nursery. Unfortunately, this bot only works with Pokemon who take 2560 steps or higher to hatch. Additionally, if you are doing a 2560-step Pokemon, only 3 eggs will be collected each cycle, meaning 12 slots will be empty each box.`,
+    description: `This bot is significantly slower than the the Collector/Hatcher combo, but does not require two separate steps. It will continually collect eggs from the Bridge Field nursery and hatch them, filling boxes up to a specified maximum. Note that, similar to the Egg Collector bot, it is possible that an egg will not be collected every time, so some spots in your boxes may be skipped. For the best results, be sure to have the Oval Charm and have Pokemon with different trainer IDs in the nursery. Unfortunately, this bot only works with Pokemon who take 2560 steps or higher to hatch.`,
     instructions: [
       'Ensure that your text speed is set to "Fast" and nicknames are set to "Don\'t Give"',
-      'Have only one Pokemon in your party, and that Pokemon must have the Flame Body ability',
+      'Have only one Pokemon in your party, ideally with the Flame Body ability',
       'Make sure that the Pokemon you are hatching is already registered in your Pokedex',
       'Go to Bridge Field and get on your bike',
       'Ensure that you are not conneced to the Internet',
@@ -524,42 +598,50 @@ export const botConfigs = [
     ],
     configFields: [
       {
-        param: 'm_eggStepGroup',
-        name: 'Egg Group Steps',
+        param: 'm_eggSteps',
+        name: 'Egg Steps',
         description:
-          "Use Serebii or Bulbapedia to figure out how many steps your Pokemon's Egg Group takes to hatch.",
+          "Use Serebii or Bulbapedia to figure out how many steps your Pokemon takes to hatch.",
         type: 'select',
         options: [
           {
             name: '2560 Steps',
-            value: 1,
+            value: 2560,
           },
           {
             name: '3840 Steps',
-            value: 2,
+            value: 3840,
           },
           {
             name: '5120 Steps',
-            value: 3,
+            value: 5120,
           },
           {
             name: '6400 Steps',
-            value: 4,
+            value: 6400,
           },
           {
             name: '7680 Steps',
-            value: 5,
+            value: 7680,
           },
           {
             name: '8960 Steps',
-            value: 6,
+            value: 8960,
           },
           {
             name: '10240 Steps',
-            value: 7,
+            value: 10240,
           },
         ],
-        value: 3,
+        value: 5120,
+      },
+      {
+        param: 'm_flameBody',
+        name: 'Flame Body',
+        description:
+          'Whether your party Pokemon has Flame Body, Magma Armor or Steam Engine. Without one, the bot bikes twice as long.',
+        type: 'bool',
+        value: 'true',
       },
       {
         param: 'm_boxesToFill',
@@ -567,6 +649,22 @@ export const botConfigs = [
         type: 'number',
         value: 3,
       },
+      {
+        param: 'm_eggsPerHour',
+        name: 'Target Eggs per Hour',
+        description:
+          'The bot picks up eggs no faster than this, spinning longer in between so an egg is more likely to be ready. Set it to 0 to pick them up as fast as they are ready.',
+        type: 'number',
+        value: 0,
+      },
+      {
+        param: 'm_spinSpeed',
+        name: 'Spin Speed',
+        description:
+          'How fast the bot turns the stick while biking in circles, in 1/256 of a turn per input. The default of 8 is about two turns a second.',
+        type: 'number',
+        value: 8,
+      },
     ],
   },
   {
@@ -656,16 +754,68 @@ export const botConfigs = [
     botActions: [
       'First, the bot will sync and unsync system time to reset to current date',
       'It will then skip one frame forward, collect Watts from the den, and exit',
-      'After the configured number of collections, it will save the game to avoid loss of Watts if the game crashes',
+      'It will save as rarely as it can without a crash losing more than the minutes of farming set here',
+    ],
+    configFields: [
+      {
+        param: 'm_maxLossMinutes',
+        name: 'Most Minutes Lost to a Crash',
+        description:
+          'The game can crash while skipping dates. The bot measures how long a collection and a save take, and saves as rarely as it can without a crash losing more than this many minutes of farming.',
+        type: 'number',
+        value: 15,
+      },
+    ],
+  },
+  {
+    name: 'Watt and Berry Farmer',
+    target: 'WattBerryFarmer',
+    description:
+      'This bot farms Watts from a wishing piece den and berries from a tree behind it, with one date skip for both.',
+    instructions: [
+      'Ensure that your text speed is set to "Fast"',
+      'Ensure that your system time is unsynced',
+      'Find a wishing piece den with a berry tree in a straight line behind you when you face the den',
+      'Stand in front of the den, facing it',
+      'Activate Y-Comm glitch',
+      'Plug in the bot to begin the loop',
+    ],
+    botActions: [
+      'First, the bot will sync and unsync system time to reset to current date',
+      'It will then skip one frame forward and collect Watts from the den',
+      'It will walk to the berry tree, shake it once and walk back to the den',
+      'It will save as rarely as it can without a crash losing more than the minutes of farming set here',
     ],
     configFields: [
       {
-        param: 'm_saveAt',
-        name: 'Save After',
+        param: 'm_denDirection',
+        name: 'Den Direction',
+        description:
+          'The direction you press to face the den. The bot walks the other way to the tree.',
+        type: 'select',
+        options: [
+          { name: 'Up', value: 0 },
+          { name: 'Right', value: 1 },
+          { name: 'Down', value: 2 },
+          { name: 'Left', value: 3 },
+        ],
+        value: 0,
+      },
+      {
+        param: 'm_treeTime',
+        name: 'Time to Tree',
+        description:
+          'How long the bot walks from the den to the tree, in inputs (about 24 ms each). Walking longer is fine, you stop at the tree.',
+        type: 'number',
+        value: 40,
+      },
+      {
+        param: 'm_maxLossMinutes',
+        name: 'Most Minutes Lost to a Crash',
         description:
-          'To avoid losing progress due to a crash, the bot will save after a specified number of Watt collections.',
+          'The game can crash while skipping dates. The bot measures how long a collection and a save take, and saves as rarely as it can without a crash losing more than this many minutes of farming.',
         type: 'number',
-        value: 50,
+        value: 15,
       },
     ],
   },
@@ -834,20 +984,36 @@ export const botConfigs = [
     name: 'Home Releaser (NEW!)',
     target: 'HomeReleaser',
     description:
-      'This bot will release Pokemon from 3 boxes in Pokemon Home. Works for both in-game boxes and Home boxes. This is much faster than releasing in game.',
+      'This bot will release Pokemon from up to 3 boxes in Pokemon Home. Works for both in-game boxes and Home boxes. This is much faster than releasing in game.',
     instructions: [
-      'Remove all wanted Pokemon from 3 consecutive boxes.',
+      'Remove all wanted Pokemon from the consecutive boxes you want to release (3 at most).',
       'Ensure there is a Pokemon at the top left corner of each box. There can be empty spots in other places in the box, just not the first slot.',
       'Plug in the bot to mass release quickly.',
     ],
     botActions: [
       'The bot will select all Pokemon in the box and release them.',
-      'It will move to the next box and repeat until it releases 3 boxes (because of the release limit).',
+      'It will move to the next box and repeat until it has released the set number of boxes (3 at most, because of the release limit).',
       'The bot then saves and exits.',
       'If you wish to release more, just enter the box again and re-plug the bot in.',
       'If you messed up somewhere, just plug the bot out and exit without saving changes before it\'s too late!'
     ],
-    configFields: [],
+    configFields: [
+      {
+        param: 'm_boxCount',
+        name: 'Boxes to Release',
+        description: 'From 1 to 3, because of the release limit.',
+        type: 'number',
+        value: 3,
+      },
+      {
+        param: 'm_lastBoxCount',
+        name: 'Pokemon in Last Box',
+        description:
+          'How many Pokemon the last box holds, filled left to right, top to bottom. The bot stops after them instead of going through the empty slots.',
+        type: 'number',
+        value: 30,
+      },
+    ],
   },
 ];
 
@@ -863,6 +1029,12 @@ export const mcuOptions = [
   { name: 'atmega32u4 (Arduino Micro/Teensy 2.0)', value: 'atmega32u4' },
 ];
 
+export const timingOptions = [
+  { name: 'Fast (OLED/V2)', value: 'fast' },
+  { name: 'Stock (V1)', value: 'stock' },
+  { name: 'Slow (modded/slow SD)', value: 'slow' },
+];
+
 export const dateSkipTimings = {
   0: 17.04,
   1: 21.84,
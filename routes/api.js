@@ -2,29 +2,69 @@ const fs = require('fs');
 const express = require('express');
 const execAsync = require('../utils/execAsync');
 const uuid = require('uuid');
-const { configTypes } = require('../utils/constants');
+const { configTypes, timingProfiles } = require('../utils/constants');
+const checkBudget = require('../utils/budget');
+const getEggSteps = require('../utils/eggSteps');
 const router = express.Router();
 
 router.get('/test', (req, res) => {
   res.json({ message: 'Success!' });
 });
 
+router.get('/eggsteps', (req, res) => {
+  const { species } = req.query;
+  const steps = getEggSteps(species);
+  if (!steps) {
+    res.status(404).json({ error: `Unknown species ${species}` });
+    return;
+  }
+  res.json({ species, steps });
+});
+
 router.get('/genhex', async (req, res) => {
   const { query } = req;
-  const { target, mcu } = query;
+  const { target, mcu, timing = 'stock', species } = query;
   const configObj = { ...query };
   delete configObj.target;
   delete configObj.mcu;
+  delete configObj.timing;
+  delete configObj.species;
   let configStr = '';
 
+  // The egg hatchers can be given the species instead of its steps
+  if (species) {
+    const steps = getEggSteps(species);
+    if (!steps) {
+      res.status(400).json({ error: `Unknown species ${species}` });
+      return;
+    }
+    configObj.m_eggSteps = steps;
+  }
+
+  if (!timingProfiles.includes(timing)) {
+    res.status(400).json({ error: `Timing must be one of ${timingProfiles}` });
+    return;
+  }
+
   const { m_linkCodes } = configObj;
 
+  // Don't spend a build on a configuration that can't fit
+  const overBudget = checkBudget(target, mcu, m_linkCodes);
+  if (overBudget) {
+    res.status(400).json({ error: overBudget });
+    return;
+  }
+
   if (m_linkCodes) {
-    configStr = `${
+    const linkCodes = [].concat(m_linkCodes);
+    if (!linkCodes.every((code) => /^\d{8}$/.test(code))) {
+      res.status(400).json({ error: 'Link codes must be 8 digits' });
+      return;
+    }
+    // Packed BCD in flash, one hex digit per code digit
+    configStr = `static const ${
       configTypes.m_linkCodes
-    } m_linkCodes[][8] = {${m_linkCodes.map(
-      (code) => `{${code.split('').join(',')}}`,
-    )}};`;
+    } m_linkCodes[] PROGMEM = {${linkCodes.map((code) => `0x${code}`)}};`;
     delete configObj.m_linkCodes;
   }
 
@@ -32,7 +72,7 @@ router.get('/genhex', async (req, res) => {
   if (keys.length) {
     configStr = `${configStr}${Object.keys(configObj)
       .map((key) => {
-        return `${configTypes[key]} ${key} = ${configObj[key]}`;
+        return `static const ${configTypes[key]} ${key} = ${configObj[key]}`;
       })
       .join(';')};`;
   }
@@ -42,14 +82,14 @@ router.get('/genhex', async (req, res) => {
   try {
     await execAsync(`mkdir -p tmp/${folder}`);
     await execAsync(
-      `cp -r bots/makefile bots/HORI_Descriptors bots/Joystick.h bots/LUFA bots/Config bots/${target} tmp/${folder}`,
+      `cp -r bots/makefile bots/HORI_Descriptors bots/Joystick.h bots/Joystick.c bots/LUFA bots/Config bots/Common bots/${target} tmp/${folder}`,
     );
 
     if (configStr.length) {
       fs.writeFileSync(`tmp/${folder}/${target}/Config.h`, configStr);
     }
 
-    await execAsync(`cd tmp/${folder} && make TARGET=${target} MCU=${mcu}`);
+    await execAsync(`cd tmp/${folder} && make TARGET=${target} MCU=${mcu} TIMING=${timing}`);
     res.download(`tmp/${folder}/${target}.hex`);
   } catch (e) {
     res.status(500).json({ error: e });
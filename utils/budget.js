@@ -0,0 +1,40 @@
+const fs = require('fs');
+const path = require('path');
+const { mcuBudgets, stackReserve } = require('./constants');
+
+// Written by bots/tools/size_report.js
+const SIZES = path.join(__dirname, '../bots/tools/sizes.json');
+// Each AutoHost link code is 8 BCD digits packed in a uint32_t, kept in flash
+const LINK_CODE_BYTES = 4;
+
+let sizes = {};
+try {
+  sizes = JSON.parse(fs.readFileSync(SIZES, 'utf8'));
+} catch (e) {
+  // No size report yet, nothing is refused
+}
+
+// Returns why target wouldn't fit on mcu with this configuration, or null if
+// it should fit (or its size is unknown).
+function checkBudget(target, mcu, linkCodes = []) {
+  const budget = mcuBudgets[mcu];
+  const measured = sizes[target] && sizes[target][mcu];
+  if (!budget || !measured) {
+    return null;
+  }
+
+  const extra = [].concat(linkCodes).length * LINK_CODE_BYTES;
+  const flash = measured.flash + extra;
+  const sram = measured.sram;
+  if (flash > budget.flash) {
+    return `${target} needs ${flash} bytes of flash, ${mcu} has ${budget.flash}`;
+  }
+  if (sram > budget.sram - stackReserve) {
+    return `${target} needs ${sram} bytes of SRAM, ${mcu} has ${
+      budget.sram - stackReserve
+    } left after the stack`;
+  }
+  return null;
+}
+
+module.exports = checkBudget;
@@ -10,32 +10,54 @@ const configTypes = {
   m_useLinkCode: 'bool',
   m_useRandomCode: 'bool',
   m_seed: 'uint8_t',
-  m_linkCodes: 'uint8_t',
+  m_linkCodes: 'uint32_t',
   m_waitTime: 'uint8_t',
   m_addFriends: 'bool',
   m_profile: 'uint8_t',
   m_alternate: 'bool',
   m_dayToSkip: 'unsigned long',
-  m_saveAt: 'uint16_t',
+  m_maxLossMinutes: 'uint16_t',
+  m_denDirection: 'uint8_t',
+  m_treeTime: 'uint16_t',
   m_boxCount: 'int',
+  m_lastBoxCount: 'uint8_t',
   m_boxesToTrade: 'uint8_t',
   m_completeDex: 'bool',
   m_day: 'uint8_t',
   m_month: 'uint8_t',
   m_year: 'int',
   m_maxCycle: 'int',
-  m_eggStepGroup: 'uint8_t',
+  m_eggSteps: 'uint16_t',
+  m_flameBody: 'bool',
   m_columnsOfEggs: 'uint8_t',
   m_deleteCount: 'unsigned int',
   m_addFriend: 'bool',
   m_titleScreenBuffer: 'bool',
   m_boxesToFill: 'uint8_t',
+  m_spinSpeed: 'uint8_t',
+  m_eggsPerHour: 'uint16_t',
   m_localMode: 'bool',
   m_daysToSkip: 'uint16_t',
   m_fastMode: 'bool',
   m_type: 'uint8_t',
+  m_resumeProgress: 'bool',
 };
 
+// Space available to a bot on each MCU: flash minus the bootloader, and SRAM
+// of which stackReserve bytes are kept free for the stack.
+const mcuBudgets = {
+  atmega16u2: { flash: 16384 - 4096, sram: 512 },
+  atmega32u4: { flash: 32768 - 4096, sram: 2560 },
+  at90usb1286: { flash: 131072 - 8192, sram: 8192 },
+};
+const stackReserve = 96;
+
+// TIMING profiles of bots/makefile, see bots/Common/Timing.h
+const timingProfiles = ['fast', 'stock', 'slow'];
+
 module.exports = {
   configTypes,
+  mcuBudgets,
+  stackReserve,
+  timingProfiles,
 };
@@ -0,0 +1,20 @@
+const fs = require('fs');
+const path = require('path');
+
+// Steps each species takes to hatch, one "Species,steps" per line
+const EGG_CYCLES = path.join(__dirname, '../bots/EggHatcher/EggCycles.txt');
+
+const eggSteps = new Map();
+for (const line of fs.readFileSync(EGG_CYCLES, 'utf8').split('\n')) {
+  const [species, steps] = line.trim().split(',');
+  if (species && steps) {
+    eggSteps.set(species.toLowerCase(), parseInt(steps, 10));
+  }
+}
+
+// Steps species takes to hatch, or undefined if it isn't in the table.
+function getEggSteps(species) {
+  return eggSteps.get(`${species}`.trim().toLowerCase());
+}
+
+module.exports = getEggSteps;